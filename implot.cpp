@@ -65,6 +65,24 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 #define sprintf sprintf_s
 #endif
 
+// Platform headers for ImPlotMappedFile (define IMPLOT_DISABLE_FILE_MAPPING to remove them)
+#ifndef IMPLOT_DISABLE_FILE_MAPPING
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
 // Global plot context
 ImPlotContext* GImPlot = NULL;
 
@@ -77,6 +95,345 @@ ImPlotRange::ImPlotRange() {
     Max = NAN;
 }
 
+bool ImPlotMappedFile::Open(const char* filename) {
+    Close();
+#if defined(IMPLOT_DISABLE_FILE_MAPPING)
+    IM_UNUSED(filename);
+    return false;
+#elif defined(_WIN32)
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file); // the mapping keeps the file open
+    if (mapping == NULL)
+        return false;
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return false;
+    }
+    Data   = data;
+    Size   = (size_t)size.QuadPart;
+    Handle = mapping;
+    return true;
+#elif defined(__unix__) || defined(__APPLE__)
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps the file open
+    if (data == MAP_FAILED)
+        return false;
+    Data = data;
+    Size = (size_t)st.st_size;
+    return true;
+#else
+    IM_UNUSED(filename);
+    return false;
+#endif
+}
+
+void ImPlotMappedFile::Close() {
+    if (Data == NULL)
+        return;
+#if defined(IMPLOT_DISABLE_FILE_MAPPING)
+#elif defined(_WIN32)
+    UnmapViewOfFile(Data);
+    CloseHandle((HANDLE)Handle);
+#elif defined(__unix__) || defined(__APPLE__)
+    munmap((void*)Data, Size);
+#endif
+    Data   = NULL;
+    Size   = 0;
+    Handle = NULL;
+}
+
+// Bit stream helpers for ImPlotCompressedSeries (most significant bit first)
+static void WriteBits(ImVector<ImU8>& bytes, int& fill, ImU64 value, int n) {
+    while (n > 0) {
+        if (fill == 8 || bytes.Size == 0) {
+            bytes.push_back(0);
+            fill = 0;
+        }
+        const int take = ImMin(8 - fill, n);
+        const ImU8 chunk = (ImU8)((value >> (n - take)) & ((1u << take) - 1));
+        bytes.back() |= (ImU8)(chunk << (8 - fill - take));
+        fill += take;
+        n    -= take;
+    }
+}
+
+static ImU64 ReadBits(const ImU8* bytes, ImS64& pos, int n) {
+    ImU64 value = 0;
+    while (n > 0) {
+        const int bit  = (int)(pos & 7);
+        const int take = ImMin(8 - bit, n);
+        value = (value << take) | ((bytes[pos >> 3] >> (8 - bit - take)) & ((1u << take) - 1));
+        pos += take;
+        n   -= take;
+    }
+    return value;
+}
+
+static int CountLeadingZeros64(ImU64 v) {
+    int n = 0;
+    if (!(v & 0xFFFFFFFF00000000ull)) { n += 32; v <<= 32; }
+    if (!(v & 0xFFFF000000000000ull)) { n += 16; v <<= 16; }
+    if (!(v & 0xFF00000000000000ull)) { n += 8;  v <<= 8;  }
+    if (!(v & 0xF000000000000000ull)) { n += 4;  v <<= 4;  }
+    if (!(v & 0xC000000000000000ull)) { n += 2;  v <<= 2;  }
+    if (!(v & 0x8000000000000000ull)) { n += 1; }
+    return n;
+}
+
+static int CountTrailingZeros64(ImU64 v) {
+    int n = 0;
+    if (!(v & 0x00000000FFFFFFFFull)) { n += 32; v >>= 32; }
+    if (!(v & 0x000000000000FFFFull)) { n += 16; v >>= 16; }
+    if (!(v & 0x00000000000000FFull)) { n += 8;  v >>= 8;  }
+    if (!(v & 0x000000000000000Full)) { n += 4;  v >>= 4;  }
+    if (!(v & 0x0000000000000003ull)) { n += 2;  v >>= 2;  }
+    if (!(v & 0x0000000000000001ull)) { n += 1; }
+    return n;
+}
+
+// Writes a delta-of-delta with variable length buckets ('0', '10', '110', '1110' + 7/9/12 bits, '11110' + 64 bits)
+static void WriteDeltaOfDelta(ImVector<ImU8>& bytes, int& fill, ImS64 dod) {
+    if (dod == 0)
+        WriteBits(bytes, fill, 0, 1);
+    else if (dod >= -63 && dod <= 64)
+        WriteBits(bytes, fill, (0x2ull << 7) | (ImU64)(dod + 63), 9);
+    else if (dod >= -255 && dod <= 256)
+        WriteBits(bytes, fill, (0x6ull << 9) | (ImU64)(dod + 255), 12);
+    else if (dod >= -2047 && dod <= 2048)
+        WriteBits(bytes, fill, (0xEull << 12) | (ImU64)(dod + 2047), 16);
+    else {
+        WriteBits(bytes, fill, 0x1E, 5);
+        WriteBits(bytes, fill, (ImU64)dod, 64);
+    }
+}
+
+// Reads a delta-of-delta. Returns false for the escape code '11111', which is followed by a raw value instead.
+static bool ReadDeltaOfDelta(const ImU8* bytes, ImS64& pos, ImS64* dod) {
+    if (ReadBits(bytes, pos, 1) == 0)
+        *dod = 0;
+    else if (ReadBits(bytes, pos, 1) == 0)
+        *dod = (ImS64)ReadBits(bytes, pos, 7) - 63;
+    else if (ReadBits(bytes, pos, 1) == 0)
+        *dod = (ImS64)ReadBits(bytes, pos, 9) - 255;
+    else if (ReadBits(bytes, pos, 1) == 0)
+        *dod = (ImS64)ReadBits(bytes, pos, 12) - 2047;
+    else if (ReadBits(bytes, pos, 1) == 0)
+        *dod = (ImS64)ReadBits(bytes, pos, 64);
+    else
+        return false;
+    return true;
+}
+
+ImPlotCompressedSeries::ImPlotCompressedSeries(int block_size, double x_scale, ImS64 x_origin, double y_quantum) {
+    IM_ASSERT(block_size > 1 && x_scale > 0 && y_quantum >= 0);
+    BlockSize = block_size;
+    XScale    = x_scale;
+    XOrigin   = x_origin;
+    YQuantum  = y_quantum;
+    Clear();
+}
+
+void ImPlotCompressedSeries::Clear() {
+    Bytes.clear();
+    Blocks.clear();
+    Count   = 0;
+    BitFill = 8;
+    PrevX = PrevDelta = 0;
+    PrevY = 0;
+    PrevLead = PrevTrail = -1;
+    PrevQ = PrevQDelta = 0;
+}
+
+void ImPlotCompressedSeries::AddPoint(ImS64 x, double y) {
+    if (Blocks.Size == 0 || Blocks.back().Count == BlockSize) {
+        // start a new block on a byte boundary with the first X stored raw
+        ImPlotCompressedBlock block;
+        block.ByteOffset = Bytes.Size;
+        block.Count = 0;
+        block.XMin  = x;
+        block.YMin  = HUGE_VAL;
+        block.YMax  = -HUGE_VAL;
+        Blocks.push_back(block);
+        BitFill = 8;
+        WriteBits(Bytes, BitFill, (ImU64)x, 64);
+        PrevDelta = 0;
+        PrevY = 0;
+        PrevLead = PrevTrail = -1;
+        PrevQ = PrevQDelta = 0;
+    }
+    else {
+        IM_ASSERT_USER_ERROR(x >= PrevX, "X values of a compressed series must be increasing!");
+        const ImS64 delta = x - PrevX;
+        WriteDeltaOfDelta(Bytes, BitFill, delta - PrevDelta);
+        PrevDelta = delta;
+    }
+    PrevX = x;
+    if (YQuantum > 0) {
+        // Y: rounded to a multiple of YQuantum and stored as a delta-of-delta, values that can't be are escaped and stored raw
+        const double q = floor(y / YQuantum + 0.5);
+        if (q > -4.0e18 && q < 4.0e18) {
+            const ImS64 qi    = (ImS64)q;
+            const ImS64 delta = qi - PrevQ;
+            WriteDeltaOfDelta(Bytes, BitFill, delta - PrevQDelta);
+            PrevQ      = qi;
+            PrevQDelta = delta;
+            y = (double)qi * YQuantum;
+        }
+        else {
+            ImU64 bits;
+            memcpy(&bits, &y, sizeof(bits));
+            WriteBits(Bytes, BitFill, 0x1F, 5);
+            WriteBits(Bytes, BitFill, bits, 64);
+        }
+    }
+    else {
+        // Y: XOR with the previous value, reusing the previous window of meaningful bits when possible
+        ImU64 bits;
+        memcpy(&bits, &y, sizeof(bits));
+        const ImU64 xr = bits ^ PrevY;
+        if (xr == 0)
+            WriteBits(Bytes, BitFill, 0, 1);
+        else {
+            const int lead  = ImMin(CountLeadingZeros64(xr), 31);
+            const int trail = CountTrailingZeros64(xr);
+            if (PrevLead != -1 && lead >= PrevLead && trail >= PrevTrail) {
+                WriteBits(Bytes, BitFill, 0x2, 2);
+                WriteBits(Bytes, BitFill, xr >> PrevTrail, 64 - PrevLead - PrevTrail);
+            }
+            else {
+                const int len = 64 - lead - trail;
+                WriteBits(Bytes, BitFill, (0x3ull << 11) | ((ImU64)lead << 6) | (ImU64)(len - 1), 13);
+                WriteBits(Bytes, BitFill, xr >> trail, len);
+                PrevLead  = lead;
+                PrevTrail = trail;
+            }
+        }
+        PrevY = bits;
+    }
+    ImPlotCompressedBlock& block = Blocks.back();
+    block.Count++;
+    block.XMax = x;
+    if (!ImPlot::NanOrInf(y)) {
+        block.YMin = ImMin(block.YMin, y);
+        block.YMax = ImMax(block.YMax, y);
+    }
+    Count++;
+}
+
+void ImPlotCompressedSeries::DecodeBlock(int b, ImVector<ImPlotPoint>* out) const {
+    const ImPlotCompressedBlock& block = Blocks[b];
+    const ImU8* data = Bytes.Data;
+    ImS64 pos   = (ImS64)block.ByteOffset * 8;
+    ImS64 x     = 0, delta = 0;
+    ImU64 bits  = 0;
+    ImS64 q     = 0, q_delta = 0;
+    int lead = 0, trail = 0;
+    double y = 0;
+    for (int i = 0; i < block.Count; ++i) {
+        if (i == 0)
+            x = (ImS64)ReadBits(data, pos, 64);
+        else {
+            ImS64 dod;
+            ReadDeltaOfDelta(data, pos, &dod);
+            delta += dod;
+            x     += delta;
+        }
+        if (YQuantum > 0) {
+            ImS64 dod;
+            if (ReadDeltaOfDelta(data, pos, &dod)) {
+                q_delta += dod;
+                q       += q_delta;
+                y = (double)q * YQuantum;
+            }
+            else {
+                bits = ReadBits(data, pos, 64);
+                memcpy(&y, &bits, sizeof(y));
+            }
+        }
+        else {
+            if (ReadBits(data, pos, 1) != 0) {
+                if (ReadBits(data, pos, 1) != 0) {
+                    lead  = (int)ReadBits(data, pos, 5);
+                    trail = 64 - lead - ((int)ReadBits(data, pos, 6) + 1);
+                }
+                bits ^= ReadBits(data, pos, 64 - lead - trail) << trail;
+            }
+            memcpy(&y, &bits, sizeof(y));
+        }
+        out->push_back(ImPlotPoint(GetX(x), y));
+    }
+}
+
+ImPlotQuantizedSeries::ImPlotQuantizedSeries(double max_error, double x0, double dx, int block_size) {
+    IM_ASSERT(max_error >= 0 && block_size > 0);
+    MaxError  = max_error;
+    X0        = x0;
+    Dx        = dx;
+    BlockSize = block_size;
+    Pending.reserve(block_size);
+}
+
+void ImPlotQuantizedSeries::AddPoint(double y) {
+    Pending.push_back(y);
+    if (Pending.Size == BlockSize)
+        FlushBlock();
+}
+
+void ImPlotQuantizedSeries::FlushBlock() {
+    IM_ASSERT(Pending.Size == BlockSize);
+    double y_min = HUGE_VAL, y_max = -HUGE_VAL;
+    for (int i = 0; i < Pending.Size; ++i) {
+        if (!ImPlot::NanOrInf(Pending[i])) {
+            y_min = ImMin(y_min, Pending[i]);
+            y_max = ImMax(y_max, Pending[i]);
+        }
+    }
+    if (y_min > y_max)
+        y_min = y_max = 0;
+    // the largest code of each width is reserved for non-finite values
+    const double range = y_max - y_min;
+    ImPlotQuantizedBlock block;
+    block.ByteOffset = Bytes.Size;
+    block.Width      = MaxError > 0 && range / 254 * 0.5 <= MaxError ? 1 : 2;
+    const int levels = block.Width == 1 ? 254 : 65534;
+    block.Offset     = y_min;
+    block.Scale      = range > 0 ? range / levels : 1;
+    Bytes.resize(Bytes.Size + Pending.Size * block.Width);
+    ImU8* out = Bytes.Data + block.ByteOffset;
+    for (int i = 0; i < Pending.Size; ++i) {
+        const double y = Pending[i];
+        const int q = ImPlot::NanOrInf(y) ? levels + 1 : ImClamp((int)((y - y_min) / block.Scale + 0.5), 0, levels);
+        *out++ = (ImU8)(q & 0xFF);
+        if (block.Width == 2)
+            *out++ = (ImU8)(q >> 8);
+    }
+    Blocks.push_back(block);
+    Pending.resize(0);
+}
+
+void ImPlotQuantizedSeries::Clear() {
+    Bytes.clear();
+    Blocks.clear();
+    Pending.resize(0);
+}
+
 ImPlotInputMap::ImPlotInputMap() {
     PanButton             = ImGuiMouseButton_Left;
     PanMod                = ImGuiKeyModFlags_None;
@@ -103,6 +460,7 @@ ImPlotStyle::ImPlotStyle() {
     ErrorBarWeight   = 1.5f;
     DigitalBitHeight = 8;
     DigitalBitGap    = 4;
+    LineSimplify     = 0;
 
     PlotBorderSize   = 1;
     MinorAlpha       = 0.25f;
@@ -226,6 +584,7 @@ static const ImPlotStyleVarInfo GPlotStyleVarInfo[] =
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, ErrorBarWeight)   }, // ImPlotStyleVar_ErrorBarWeight
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, DigitalBitHeight) }, // ImPlotStyleVar_DigitalBitHeight
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, DigitalBitGap)    }, // ImPlotStyleVar_DigitalBitGap
+    { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, LineSimplify)     }, // ImPlotStyleVar_LineSimplify
 
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, PlotBorderSize)   }, // ImPlotStyleVar_PlotBorderSize
     { ImGuiDataType_Float, 1, (ImU32)IM_OFFSETOF(ImPlotStyle, MinorAlpha)       }, // ImPlotStyleVar_MinorAlpha
@@ -301,6 +660,18 @@ double NiceNum(double x, bool round) {
     return nf * ImPow(10.0, expv);
 }
 
+const char* TimeUnit(double step, double* scale) {
+    step = fabs(step);
+    if (step < 1e-6)  { *scale = 1e9;          return "ns";  }
+    if (step < 1e-3)  { *scale = 1e6;          return "us";  }
+    if (step < 1)     { *scale = 1e3;          return "ms";  }
+    if (step < 60)    { *scale = 1;            return "s";   }
+    if (step < 3600)  { *scale = 1.0 / 60;     return "min"; }
+    if (step < 86400) { *scale = 1.0 / 3600;   return "h";   }
+    *scale = 1.0 / 86400;
+    return "d";
+}
+
 //-----------------------------------------------------------------------------
 // Context Utils
 //-----------------------------------------------------------------------------
@@ -344,8 +715,7 @@ void Reset(ImPlotContext* ctx) {
     // reset items count
     ctx->VisibleItemCount = 0;
     // reset legend items
-    ctx->LegendIndices.shrink(0);
-    ctx->LegendLabels.Buf.shrink(0);
+    ctx->LegendCount = 0;
     // reset ticks/labels
     ctx->XTicks.shrink(0);
     ctx->XTickLabels.Buf.shrink(0);
@@ -363,6 +733,12 @@ void Reset(ImPlotContext* ctx) {
         ctx->ExtentsY[i].Max = -HUGE_VAL;
         ctx->FitY[i] = false;
     }
+    // reset item data versions
+    ctx->NextItemDataVersion = ctx->ItemDataVersion = -1;
+    ctx->NextItemDataFinite = ctx->ItemDataFinite = false;
+    ctx->ItemCmdIndex = -1;
+    ctx->ItemCmdStart = 0;
+    ctx->BatchStart = ctx->BatchCount = 0;
     // reset digital plot items count
     ctx->DigitalPlotItemCnt = 0;
     ctx->DigitalPlotOffset = 0;
@@ -405,6 +781,13 @@ void FitPoint(const ImPlotPoint& p) {
     }
 }
 
+bool IsInView(const ImPlotLimits& bounds, bool y) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotRange& range_x = gp.CurrentPlot->XAxis.Range;
+    const ImPlotRange& range_y = gp.CurrentPlot->YAxis[gp.CurrentPlot->CurrentYAxis].Range;
+    return bounds.X.Max >= range_x.Min && bounds.X.Min <= range_x.Max && (!y || (bounds.Y.Max >= range_y.Min && bounds.Y.Min <= range_y.Max));
+}
+
 //-----------------------------------------------------------------------------
 // Coordinate Utils
 //-----------------------------------------------------------------------------
@@ -425,6 +808,30 @@ void UpdateTransformCache() {
         gp.LogDenY[i] = ImLog10(gp.CurrentPlot->YAxis[i].Range.Max / gp.CurrentPlot->YAxis[i].Range.Min);
     }
     gp.Mx = (gp.PixelRange[0].Max.x - gp.PixelRange[0].Min.x) / gp.CurrentPlot->XAxis.Range.Size();
+    // single precision transforms: the origin is rounded to float once here and its rounding error folded into the pixel offset,
+    // so per point only the float difference to the origin is scaled. The input rounding (FLT_EPSILON * |value|) must stay sub-pixel.
+    const ImPlotRange& x_range = gp.CurrentPlot->XAxis.Range;
+    gp.FltOriginX = (float)x_range.Min;
+    gp.FltPixX    = (float)(gp.PixelRange[0].Min.x + gp.Mx * ((double)gp.FltOriginX - x_range.Min));
+    gp.FltMx      = (float)gp.Mx;
+    const bool x_safe = FLT_EPSILON * ImMax(fabs(x_range.Min), fabs(x_range.Max)) * fabs(gp.Mx) <= IMPLOT_TRANSFORM_TOLERANCE;
+    for (int i = 0; i < IMPLOT_Y_AXES; i++) {
+        const ImPlotRange& y_range = gp.CurrentPlot->YAxis[i].Range;
+        gp.FltOriginY[i] = (float)y_range.Min;
+        gp.FltPixY[i]    = (float)(gp.PixelRange[i].Min.y + gp.My[i] * ((double)gp.FltOriginY[i] - y_range.Min));
+        gp.FltMy[i]      = (float)gp.My[i];
+        gp.FltSafe[i]    = x_safe && FLT_EPSILON * ImMax(fabs(y_range.Min), fabs(y_range.Max)) * fabs(gp.My[i]) <= IMPLOT_TRANSFORM_TOLERANCE;
+    }
+    // log scale transforms fuse the normalization and lerp into a single scale: pix = pix_min + m * (log2(v) - log2(min))
+    gp.Log2MinX = ImLog2(x_range.Min);
+    gp.LogMx    = (gp.PixelRange[0].Max.x - gp.PixelRange[0].Min.x) / (ImLog2(x_range.Max) - gp.Log2MinX);
+    gp.FastLogX = fabs(gp.LogMx) * IMPLOT_FAST_LOG2_ERROR <= IMPLOT_TRANSFORM_TOLERANCE;
+    for (int i = 0; i < IMPLOT_Y_AXES; i++) {
+        const ImPlotRange& y_range = gp.CurrentPlot->YAxis[i].Range;
+        gp.Log2MinY[i] = ImLog2(y_range.Min);
+        gp.LogMy[i]    = (gp.PixelRange[i].Max.y - gp.PixelRange[i].Min.y) / (ImLog2(y_range.Max) - gp.Log2MinY[i]);
+        gp.FastLogY[i] = fabs(gp.LogMy[i]) * IMPLOT_FAST_LOG2_ERROR <= IMPLOT_TRANSFORM_TOLERANCE;
+    }
 }
 
 ImPlotPoint PixelsToPlot(float x, float y, int y_axis_in) {
@@ -449,47 +856,135 @@ ImPlotPoint PixelsToPlot(const ImVec2& pix, int y_axis) {
     return PixelsToPlot(pix.x, pix.y, y_axis);
 }
 
-// This function is convenient but should not be used to process a high volume of points. Use the Transformer structs below instead.
-ImVec2 PlotToPixels(double x, double y, int y_axis_in) {
+void PixelsToPlot(const ImVec2* pix, double* xs, double* ys, int count, int y_axis_in) {
     ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotToPixels() needs to be called between BeginPlot() and EndPlot()!");
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PixelsToPlot() needs to be called between BeginPlot() and EndPlot()!");
     const int y_axis = y_axis_in >= 0 ? y_axis_in : gp.CurrentPlot->CurrentYAxis;
-    ImVec2 pix;
+    const ImRect& range = gp.PixelRange[y_axis];
     if (ImHasFlag(gp.CurrentPlot->XAxis.Flags, ImPlotAxisFlags_LogScale)) {
-        double t = ImLog10(x / gp.CurrentPlot->XAxis.Range.Min) / gp.LogDenX;
-        x       = ImLerp(gp.CurrentPlot->XAxis.Range.Min, gp.CurrentPlot->XAxis.Range.Max, (float)t);
+        const double o = gp.Log2MinX * 0.6931471805599453, m = 0.6931471805599453 / gp.LogMx;
+        for (int i = 0; i < count; ++i)
+            xs[i] = exp(o + (pix[i].x - range.Min.x) * m);
+    }
+    else {
+        const double o = gp.CurrentPlot->XAxis.Range.Min, m = 1 / gp.Mx;
+        for (int i = 0; i < count; ++i)
+            xs[i] = o + (pix[i].x - range.Min.x) * m;
     }
     if (ImHasFlag(gp.CurrentPlot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale)) {
-        double t = ImLog10(y / gp.CurrentPlot->YAxis[y_axis].Range.Min) / gp.LogDenY[y_axis];
-        y       = ImLerp(gp.CurrentPlot->YAxis[y_axis].Range.Min, gp.CurrentPlot->YAxis[y_axis].Range.Max, (float)t);
+        const double o = gp.Log2MinY[y_axis] * 0.6931471805599453, m = 0.6931471805599453 / gp.LogMy[y_axis];
+        for (int i = 0; i < count; ++i)
+            ys[i] = exp(o + (pix[i].y - range.Min.y) * m);
+    }
+    else {
+        const double o = gp.CurrentPlot->YAxis[y_axis].Range.Min, m = 1 / gp.My[y_axis];
+        for (int i = 0; i < count; ++i)
+            ys[i] = o + (pix[i].y - range.Min.y) * m;
     }
-    pix.x = (float)(gp.PixelRange[y_axis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min));
-    pix.y = (float)(gp.PixelRange[y_axis].Min.y + gp.My[y_axis] * (y - gp.CurrentPlot->YAxis[y_axis].Range.Min));
+}
+
+// This function is convenient but should not be used to process a high volume of points. Use the array version below instead.
+ImVec2 PlotToPixels(double x, double y, int y_axis_in) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotToPixels() needs to be called between BeginPlot() and EndPlot()!");
+    const int y_axis = y_axis_in >= 0 ? y_axis_in : gp.CurrentPlot->CurrentYAxis;
+    ImVec2 pix;
+    if (ImHasFlag(gp.CurrentPlot->XAxis.Flags, ImPlotAxisFlags_LogScale))
+        pix.x = (float)(gp.PixelRange[y_axis].Min.x + gp.LogMx * (TransformLog2(x, false) - gp.Log2MinX));
+    else
+        pix.x = (float)(gp.PixelRange[y_axis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min));
+    if (ImHasFlag(gp.CurrentPlot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+        pix.y = (float)(gp.PixelRange[y_axis].Min.y + gp.LogMy[y_axis] * (TransformLog2(y, false) - gp.Log2MinY[y_axis]));
+    else
+        pix.y = (float)(gp.PixelRange[y_axis].Min.y + gp.My[y_axis] * (y - gp.CurrentPlot->YAxis[y_axis].Range.Min));
     return pix;
 }
 
-// This function is convenient but should not be used to process a high volume of points. Use the Transformer structs below instead.
+// This function is convenient but should not be used to process a high volume of points. Use the array version below instead.
 ImVec2 PlotToPixels(const ImPlotPoint& plt, int y_axis) {
     return PlotToPixels(plt.x, plt.y, y_axis);
 }
 
+void PlotToPixels(const double* xs, const double* ys, ImVec2* pix, int count, int y_axis_in) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotToPixels() needs to be called between BeginPlot() and EndPlot()!");
+    const int y_axis = y_axis_in >= 0 ? y_axis_in : gp.CurrentPlot->CurrentYAxis;
+    const ImRect& range = gp.PixelRange[y_axis];
+    if (ImHasFlag(gp.CurrentPlot->XAxis.Flags, ImPlotAxisFlags_LogScale)) {
+        const double o = gp.Log2MinX, m = gp.LogMx;
+        const bool fast = gp.FastLogX;
+        for (int i = 0; i < count; ++i)
+            pix[i].x = (float)(range.Min.x + m * (TransformLog2(xs[i], fast) - o));
+    }
+    else {
+        const double o = gp.CurrentPlot->XAxis.Range.Min, m = gp.Mx;
+        for (int i = 0; i < count; ++i)
+            pix[i].x = (float)(range.Min.x + m * (xs[i] - o));
+    }
+    if (ImHasFlag(gp.CurrentPlot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale)) {
+        const double o = gp.Log2MinY[y_axis], m = gp.LogMy[y_axis];
+        const bool fast = gp.FastLogY[y_axis];
+        for (int i = 0; i < count; ++i)
+            pix[i].y = (float)(range.Min.y + m * (TransformLog2(ys[i], fast) - o));
+    }
+    else {
+        const double o = gp.CurrentPlot->YAxis[y_axis].Range.Min, m = gp.My[y_axis];
+        for (int i = 0; i < count; ++i)
+            pix[i].y = (float)(range.Min.y + m * (ys[i] - o));
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Item Utils
 //-----------------------------------------------------------------------------
 
-ImPlotItem* RegisterOrGetItem(const char* label_id) {
+// Stores the label of an item in its plot's persistent label buffer. Does nothing if the label is unchanged.
+static void SetItemLabel(ImPlotState& plot, ImPlotItem* item, const char* label_id) {
+    if (item->NameOffset != -1) {
+        const char* prev = plot.LegendLabels.Buf.Data + item->NameOffset;
+        if (strcmp(prev, label_id) == 0)
+            return;
+        plot.LegendLabelsUnused += (int)strlen(prev) + 1;
+        item->NameOffset = -1;
+    }
+    item->NameWidth  = -1;
+    plot.LegendDirty = true;
+    if (ImGui::FindRenderedTextEnd(label_id, NULL) != label_id) {
+        item->NameOffset = plot.LegendLabels.size();
+        plot.LegendLabels.append(label_id, label_id + strlen(label_id) + 1);
+    }
+    // compact the buffer once more than half of it is taken up by stale labels
+    if (plot.LegendLabelsUnused > plot.LegendLabels.size() / 2) {
+        ImGuiTextBuffer labels;
+        for (int i = 0; i < plot.Items.GetSize(); ++i) {
+            ImPlotItem* it = plot.Items.GetByIndex(i);
+            if (it->NameOffset != -1) {
+                const char* label = plot.LegendLabels.Buf.Data + it->NameOffset;
+                it->NameOffset = labels.size();
+                labels.append(label, label + strlen(label) + 1);
+            }
+        }
+        plot.LegendLabels.Buf.swap(labels.Buf);
+        plot.LegendLabelsUnused = 0;
+    }
+}
+
+// Marks an item as seen this frame and adds it to the legend. The legend order is only rewritten when it differs from last frame.
+static ImPlotItem* RegisterItem(ImPlotState& plot, ImPlotItem* item) {
     ImPlotContext& gp = *GImPlot;
-    ImGuiID id = ImGui::GetID(label_id);
-    ImPlotItem* item = gp.CurrentPlot->Items.GetOrAddByKey(id);
-    if (item->SeenThisFrame)
-        return item;
     item->SeenThisFrame = true;
-    int idx = gp.CurrentPlot->Items.GetIndex(item);
-    item->ID = id;
-    if (ImGui::FindRenderedTextEnd(label_id, NULL) != label_id) {
-        gp.LegendIndices.push_back(idx);
-        item->NameOffset = gp.LegendLabels.size();
-        gp.LegendLabels.append(label_id, label_id + strlen(label_id) + 1);
+    if (item->Recolor) {
+        item->Color   = NextColormapColor();
+        item->Recolor = false;
+    }
+    if (item->NameOffset != -1) {
+        const int idx = plot.Items.GetIndex(item);
+        const int n   = gp.LegendCount++;
+        if (n >= plot.LegendIndices.Size || plot.LegendIndices[n] != idx) {
+            plot.LegendIndices.resize(n);
+            plot.LegendIndices.push_back(idx);
+            plot.LegendDirty = true;
+        }
     }
     else {
         item->Show = true;
@@ -499,9 +994,80 @@ ImPlotItem* RegisterOrGetItem(const char* label_id) {
     return item;
 }
 
+// Attributes the draw commands added since the last call to the item that was being counted. Items are tracked
+// by index since adding items to the pool may move them.
+static void EndItemDrawCmds(ImPlotState& plot) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.ItemCmdIndex >= 0 && gp.ItemCmdIndex < plot.Items.GetSize())
+        plot.Items.GetByIndex(gp.ItemCmdIndex)->DrawCmdCount += ImGui::GetWindowDrawList()->CmdBuffer.Size - gp.ItemCmdStart;
+    gp.ItemCmdIndex = -1;
+}
+
+static void BeginItemDrawCmds(ImPlotState& plot, ImPlotItem* item) {
+    ImPlotContext& gp = *GImPlot;
+    if (!item->SeenThisFrame)
+        item->DrawCmdCount = 0;
+    gp.ItemCmdIndex = plot.Items.GetIndex(item);
+    gp.ItemCmdStart = ImGui::GetWindowDrawList()->CmdBuffer.Size;
+}
+
+ImPlotItem* RegisterOrGetItem(const char* label_id) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotState& plot = *gp.CurrentPlot;
+    EndItemDrawCmds(plot);
+    ImGuiID id = ImGui::GetID(label_id);
+    ImPlotItem* item = plot.Items.GetOrAddByKey(id);
+    BeginItemDrawCmds(plot, item);
+    gp.ItemDataVersion     = item->SeenThisFrame ? -1 : gp.NextItemDataVersion;
+    gp.NextItemDataVersion = -1;
+    gp.ItemDataFinite      = gp.NextItemDataFinite;
+    gp.NextItemDataFinite  = false;
+    if (item->SeenThisFrame)
+        return item;
+    item->ID = id;
+    SetItemLabel(plot, item, label_id);
+    return RegisterItem(plot, item);
+}
+
+ImPlotItem* RegisterOrGetItem(const ImPlotItemHandle& handle) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotState& plot = *gp.CurrentPlot;
+    IM_ASSERT_USER_ERROR(handle.ID != 0, "Invalid ImPlotItemHandle! Use GetItemHandle() to obtain one.");
+    EndItemDrawCmds(plot);
+    ImPlotItem* item = NULL;
+    if (handle.Index >= 0 && handle.Index < plot.Items.GetSize())
+        item = plot.Items.GetByIndex(handle.Index);
+    if (item == NULL || item->ID != handle.ID) {
+        item = plot.Items.GetOrAddByKey(handle.ID);
+        item->ID = handle.ID;
+    }
+    BeginItemDrawCmds(plot, item);
+    gp.ItemDataVersion     = item->SeenThisFrame ? -1 : gp.NextItemDataVersion;
+    gp.NextItemDataVersion = -1;
+    gp.ItemDataFinite      = gp.NextItemDataFinite;
+    gp.NextItemDataFinite  = false;
+    if (item->SeenThisFrame)
+        return item;
+    return RegisterItem(plot, item);
+}
+
+ImPlotItemHandle GetItemHandle(const char* label_id) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "GetItemHandle() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlotState& plot = *gp.CurrentPlot;
+    ImGuiID id = ImGui::GetID(label_id);
+    ImPlotItem* item = plot.Items.GetOrAddByKey(id);
+    item->ID = id;
+    SetItemLabel(plot, item, label_id);
+    ImPlotItemHandle handle;
+    handle.ID    = id;
+    handle.Index = plot.Items.GetIndex(item);
+    return handle;
+}
+
 ImPlotItem* GetItem(int i) {
     ImPlotContext& gp = *GImPlot;
-    return gp.CurrentPlot->Items.GetByIndex(gp.LegendIndices[i]);
+    return gp.CurrentPlot->Items.GetByIndex(gp.CurrentPlot->LegendIndices[i]);
 }
 
 ImPlotItem* GetItem(const char* label_id) {
@@ -524,7 +1090,8 @@ void BustItemCache() {
     for (int p = 0; p < gp.Plots.GetSize(); ++p) {
         ImPlotState& plot = *gp.Plots.GetByIndex(p);
         plot.ColormapIdx = 0;
-        plot.Items.Clear();
+        for (int i = 0; i < plot.Items.GetSize(); ++i)
+            plot.Items.GetByIndex(i)->Recolor = true;
     }
 }
 
@@ -534,23 +1101,56 @@ void BustItemCache() {
 
 int GetLegendCount() {
     ImPlotContext& gp = *GImPlot;
-    return gp.LegendIndices.size();
+    return gp.LegendCount;
 }
 
 const char* GetLegendLabel(int i) {
     ImPlotContext& gp = *GImPlot;
-    ImPlotItem* item  = gp.CurrentPlot->Items.GetByIndex(gp.LegendIndices[i]);
-    IM_ASSERT(item->NameOffset != -1 && item->NameOffset < gp.LegendLabels.Buf.Size);
-    return gp.LegendLabels.Buf.Data + item->NameOffset;
+    ImPlotState& plot = *gp.CurrentPlot;
+    ImPlotItem* item  = plot.Items.GetByIndex(plot.LegendIndices[i]);
+    IM_ASSERT(item->NameOffset != -1 && item->NameOffset < plot.LegendLabels.Buf.Size);
+    return plot.LegendLabels.Buf.Data + item->NameOffset;
+}
+
+void UpdateLegendEntries(bool filter) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotState& plot = *gp.CurrentPlot;
+    // cached label widths are only valid for the font size they were measured with
+    const float font_size = ImGui::GetFontSize();
+    if (plot.LegendFontSize != font_size) {
+        for (int i = 0; i < plot.Items.GetSize(); ++i)
+            plot.Items.GetByIndex(i)->NameWidth = -1;
+        plot.LegendFontSize = font_size;
+        plot.LegendDirty    = true;
+    }
+    const bool use_filter = filter && plot.LegendFilter[0] != 0;
+    if (use_filter != plot.LegendFiltered)
+        plot.LegendDirty = true;
+    if (!plot.LegendDirty)
+        return;
+    plot.LegendEntries.shrink(0);
+    plot.LegendWidth = 0;
+    for (int i = 0; i < GetLegendCount(); ++i) {
+        ImPlotItem* item      = GetItem(i);
+        const char* label     = GetLegendLabel(i);
+        const char* label_end = ImGui::FindRenderedTextEnd(label, NULL);
+        if (use_filter && ImStristr(label, label_end, plot.LegendFilter, NULL) == NULL)
+            continue;
+        if (item->NameWidth < 0)
+            item->NameWidth = ImGui::CalcTextSize(label, label_end).x;
+        plot.LegendWidth = ImMax(plot.LegendWidth, item->NameWidth);
+        plot.LegendEntries.push_back(i);
+    }
+    plot.LegendFiltered = use_filter;
+    plot.LegendDirty    = false;
 }
 
 //-----------------------------------------------------------------------------
 // Tick Utils
 //-----------------------------------------------------------------------------
 
-void AddTicksDefault(const ImPlotRange& range, int nMajor, int nMinor, ImVector<ImPlotTick> &out) {
-    const double nice_range = NiceNum(range.Size() * 0.99, false);
-    const double interval   = NiceNum(nice_range / (nMajor - 1), true);
+// Adds major ticks every #interval and #nMinor - 1 minor ticks between them
+static void AddTicksInterval(const ImPlotRange& range, double interval, int nMinor, ImVector<ImPlotTick> &out) {
     const double graphmin   = floor(range.Min / interval) * interval;
     const double graphmax   = ceil(range.Max / interval) * interval;
     for (double major = graphmin; major < graphmax + 0.5 * interval; major += interval) {
@@ -564,6 +1164,33 @@ void AddTicksDefault(const ImPlotRange& range, int nMajor, int nMinor, ImVector<
     }
 }
 
+void AddTicksDefault(const ImPlotRange& range, int nMajor, int nMinor, ImVector<ImPlotTick> &out) {
+    const double nice_range = NiceNum(range.Size() * 0.99, false);
+    const double interval   = NiceNum(nice_range / (nMajor - 1), true);
+    AddTicksInterval(range, interval, nMinor, out);
+}
+
+void AddTicksTime(const ImPlotRange& range, int nMajor, ImVector<ImPlotTick>& out) {
+    // steps above one minute follow clock divisions rather than powers of ten
+    static const double steps[]  = { 60, 120, 300, 600, 900, 1800, 3600, 7200, 10800, 21600, 43200, 86400 };
+    static const int    minors[] = {  6,   4,   5,  10,   3,    6,    4,    4,     3,     6,     4,     4 };
+    const double nice_range = NiceNum(range.Size() * 0.99, false);
+    double interval = NiceNum(nice_range / (nMajor - 1), true);
+    int nMinor = IMPLOT_SUB_DIV;
+    if (interval >= 86400) {
+        interval = 86400 * NiceNum(interval / 86400, true);
+    }
+    else if (interval >= 60) {
+        const double raw = range.Size() / (nMajor - 1);
+        int i = 0;
+        while (i < IM_ARRAYSIZE(steps) - 1 && steps[i] < raw)
+            ++i;
+        interval = steps[i];
+        nMinor   = minors[i];
+    }
+    AddTicksInterval(range, interval, nMinor, out);
+}
+
 void AddTicksLogarithmic(const ImPlotRange& range, int nMajor, ImVector<ImPlotTick>& out) {
     if (range.Min <= 0 || range.Max <= 0)
         return;
@@ -625,6 +1252,24 @@ void LabelTicks(ImVector<ImPlotTick> &ticks, bool scientific, ImGuiTextBuffer& b
     }
 }
 
+void LabelTicksTime(ImVector<ImPlotTick> &ticks, ImGuiTextBuffer& buffer) {
+    if (ticks.Size == 0)
+        return;
+    double scale;
+    const char* unit = TimeUnit(ticks.Size > 1 ? ticks[1].PlotPos - ticks[0].PlotPos : ticks[0].PlotPos, &scale);
+    char temp[32];
+    for (int t = 0; t < ticks.Size; t++) {
+        ImPlotTick *tk = &ticks[t];
+        if (tk->ShowLabel && !tk->Labeled) {
+            tk->BufferOffset = buffer.size();
+            sprintf(temp, "%.10g %s", tk->PlotPos * scale, unit);
+            buffer.append(temp, temp + strlen(temp) + 1);
+            tk->LabelSize = ImGui::CalcTextSize(buffer.Buf.Data + tk->BufferOffset);
+            tk->Labeled = true;
+        }
+    }
+}
+
 float MaxTickLabelWidth(const ImVector<ImPlotTick>& ticks) {
     float w = 0;
     for (int i = 0; i < ticks.Size; ++i)
@@ -664,6 +1309,17 @@ void UpdateAxisColors(int axis_flag, ImPlotAxisColor* col) {
 // BeginPlot()
 //-----------------------------------------------------------------------------
 
+// Computes the plot frame size from the requested size, enforcing PlotMinSize when size is negative (fill)
+static ImVec2 CalcPlotFrameSize(const ImVec2& size) {
+    ImPlotContext& gp = *GImPlot;
+    ImVec2 frame_size = ImGui::CalcItemSize(size, IMPLOT_DEFAULT_W, IMPLOT_DEFAULT_H);
+    if (frame_size.x < gp.Style.PlotMinSize.x && size.x < 0.0f)
+        frame_size.x = gp.Style.PlotMinSize.x;
+    if (frame_size.y < gp.Style.PlotMinSize.y && size.y < 0.0f)
+        frame_size.y = gp.Style.PlotMinSize.y;
+    return frame_size;
+}
+
 bool BeginPlot(const char* title, const char* x_label, const char* y_label, const ImVec2& size, ImPlotFlags flags, ImPlotAxisFlags x_flags, ImPlotAxisFlags y_flags, ImPlotAxisFlags y2_flags, ImPlotAxisFlags y3_flags) {
     IM_ASSERT_USER_ERROR(GImPlot != NULL, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp = *GImPlot;
@@ -714,6 +1370,16 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     plot.YAxis[1].PreviousFlags = y2_flags;
     plot.YAxis[2].PreviousFlags = y3_flags;
 
+    // early out if the plot is entirely clipped (e.g. scrolled out of view). This happens before the
+    // child window is created, so culled plots only pay for their layout.
+    const ImVec2 outer_size = ImHasFlag(plot.Flags, ImPlotFlags_NoChild) ? CalcPlotFrameSize(size) : ImGui::CalcItemSize(size, IMPLOT_DEFAULT_W, IMPLOT_DEFAULT_H);
+    const ImRect outer_bb(Window->DC.CursorPos, Window->DC.CursorPos + outer_size);
+    if (ImGui::IsClippedEx(outer_bb, 0, false)) {
+        ImGui::ItemSize(outer_bb);
+        Reset(GImPlot);
+        return false;
+    }
+
     // capture scroll with a child region
     if (!ImHasFlag(plot.Flags, ImPlotFlags_NoChild)) {
         ImGui::BeginChild(title, ImVec2(size.x == 0 ? IMPLOT_DEFAULT_W : size.x, size.y == 0 ? IMPLOT_DEFAULT_H : size.y));
@@ -743,6 +1409,13 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
         }
     }
 
+    if (gp.NextPlotData.HasTimeOrigin) {
+        if (!plot.HasTimeOrigin || gp.NextPlotData.TimeOriginCond == ImGuiCond_Always) {
+            plot.TimeOrigin    = gp.NextPlotData.TimeOrigin;
+            plot.HasTimeOrigin = true;
+        }
+    }
+
     // AXIS STATES ------------------------------------------------------------
     gp.X    = ImPlotAxisState(&plot.XAxis,    gp.NextPlotData.HasXRange,    gp.NextPlotData.XRangeCond,    true);
     gp.Y[0] = ImPlotAxisState(&plot.YAxis[0], gp.NextPlotData.HasYRange[0], gp.NextPlotData.YRangeCond[0], true);
@@ -788,11 +1461,7 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     // BB AND HOVER -----------------------------------------------------------
 
     // frame
-    ImVec2 frame_size = ImGui::CalcItemSize(size, IMPLOT_DEFAULT_W, IMPLOT_DEFAULT_H);
-    if (frame_size.x < gp.Style.PlotMinSize.x && size.x < 0.0f)
-        frame_size.x = gp.Style.PlotMinSize.x;
-    if (frame_size.y < gp.Style.PlotMinSize.y && size.y < 0.0f)
-        frame_size.y = gp.Style.PlotMinSize.y;
+    const ImVec2 frame_size = CalcPlotFrameSize(size);
     gp.BB_Frame = ImRect(Window->DC.CursorPos, Window->DC.CursorPos + frame_size);
     ImGui::ItemSize(gp.BB_Frame);
     if (!ImGui::ItemAdd(gp.BB_Frame, 0, &gp.BB_Frame)) {
@@ -819,6 +1488,8 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     if (gp.RenderX && gp.NextPlotData.ShowDefaultTicksX) {
         if (ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LogScale))
             AddTicksLogarithmic(plot.XAxis.Range, (int)(gp.BB_Canvas.GetWidth() * 0.01f), gp.XTicks);
+        else if (ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_Time))
+            AddTicksTime(plot.XAxis.Range, ImMax(2, (int)IM_ROUND(0.003 * gp.BB_Canvas.GetWidth())), gp.XTicks);
         else
             AddTicksDefault(plot.XAxis.Range, ImMax(2, (int)IM_ROUND(0.003 * gp.BB_Canvas.GetWidth())), IMPLOT_SUB_DIV, gp.XTicks);
     }
@@ -832,7 +1503,9 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
     }
 
     // label ticks
-    if (gp.X.HasLabels)
+    if (gp.X.HasLabels && ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_Time) && !ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LogScale))
+        LabelTicksTime(gp.XTicks, gp.XTickLabels);
+    else if (gp.X.HasLabels)
         LabelTicks(gp.XTicks, ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_Scientific) || ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LogScale), gp.XTickLabels);
 
     float max_label_widths[IMPLOT_Y_AXES];
@@ -1001,7 +1674,12 @@ bool BeginPlot(const char* title, const char* x_label, const char* y_label, cons
 
     // SCROLL INPUT -----------------------------------------------------------
 
-    if (gp.Hov_Frame && (plot.XAxis.HoveredTot || any_hov_y_axis_region) && IO.MouseWheel != 0) {
+    // scrollable legends consume the mouse wheel when they overflow (clamped in EndPlot)
+    const bool scroll_legend = hov_legend && ImHasFlag(plot.Flags, ImPlotFlags_LegendScroll) && plot.LegendScrollMax > 0;
+    if (scroll_legend && IO.MouseWheel != 0)
+        plot.LegendScroll -= IO.MouseWheel * 3 * ImGui::GetTextLineHeight();
+
+    if (gp.Hov_Frame && (plot.XAxis.HoveredTot || any_hov_y_axis_region) && IO.MouseWheel != 0 && !scroll_legend) {
         UpdateTransformCache();
         float zoom_rate = IMPLOT_ZOOM_RATE;
         if (IO.MouseWheel > 0)
@@ -1381,6 +2059,12 @@ void ShowPlotContextMenu(ImPlotState& plot) {
     if (ImGui::MenuItem("Legend",NULL,ImHasFlag(plot.Flags, ImPlotFlags_Legend))) {
         ImFlipFlag(plot.Flags, ImPlotFlags_Legend);
     }
+    if (ImHasFlag(plot.Flags, ImPlotFlags_Legend) && ImHasFlag(plot.Flags, ImPlotFlags_LegendScroll)) {
+        ImGui::PushItemWidth(150);
+        if (ImGui::InputText("Filter", plot.LegendFilter, IM_ARRAYSIZE(plot.LegendFilter)))
+            plot.LegendDirty = true;
+        ImGui::PopItemWidth();
+    }
 #if 0
     if (ImGui::BeginMenu("Metrics")) {
         ImGui::PushItemWidth(75);
@@ -1408,6 +2092,8 @@ void EndPlot() {
     ImDrawList & DrawList = *Window->DrawList;
     const ImGuiIO &   IO  = ImGui::GetIO();
 
+    EndItemDrawCmds(plot);
+
     // AXIS STATES ------------------------------------------------------------
 
     const bool any_y_locked   = gp.Y[0].Lock || gp.Y[1].Present ? gp.Y[1].Lock : false || gp.Y[2].Present ? gp.Y[2].Lock : false;
@@ -1519,6 +2205,12 @@ void EndPlot() {
         }
     }
 
+    // drop legend entries that were not submitted this frame
+    if (plot.LegendIndices.Size != gp.LegendCount) {
+        plot.LegendIndices.shrink(gp.LegendCount);
+        plot.LegendDirty = true;
+    }
+
     // render legend
     const float txt_ht = ImGui::GetTextLineHeight();
     const ImVec2 legend_offset = gp.Style.LegendPadding;
@@ -1528,14 +2220,21 @@ void EndPlot() {
     int nItems = GetLegendCount();
     bool hov_legend = false;
     if (ImHasFlag(plot.Flags, ImPlotFlags_Legend) && nItems > 0) {
-        // get max width
-        float max_label_width = 0;
-        for (int i = 0; i < nItems; ++i) {
-            const char* label = GetLegendLabel(i);
-            ImVec2 labelWidth = ImGui::CalcTextSize(label, NULL, true);
-            max_label_width   = labelWidth.x > max_label_width ? labelWidth.x : max_label_width;
+        const bool scroll = ImHasFlag(plot.Flags, ImPlotFlags_LegendScroll);
+        // label widths and filtering are cached and only recomputed when the legend changes
+        UpdateLegendEntries(scroll);
+        const int nEntries = plot.LegendEntries.Size;
+        float legend_ht = nEntries * txt_ht;
+        if (scroll) {
+            const float max_ht = ImMax(txt_ht, gp.BB_Plot.GetHeight() - 2 * legend_offset.y - 2 * legend_spacing.y);
+            legend_ht            = ImMin(legend_ht, max_ht);
+            plot.LegendScrollMax = nEntries * txt_ht - legend_ht;
+            plot.LegendScroll    = ImClamp(plot.LegendScroll, 0.0f, plot.LegendScrollMax);
         }
-        legend_content_bb = ImRect(gp.BB_Plot.Min + legend_offset, gp.BB_Plot.Min + legend_offset + ImVec2(max_label_width, nItems * txt_ht));
+        else {
+            plot.LegendScroll = plot.LegendScrollMax = 0;
+        }
+        legend_content_bb = ImRect(gp.BB_Plot.Min + legend_offset, gp.BB_Plot.Min + legend_offset + ImVec2(plot.LegendWidth, legend_ht));
         plot.BB_Legend    = ImRect(legend_content_bb.Min, legend_content_bb.Max + legend_spacing * 2 + ImVec2(legend_icon_size, 0));
         hov_legend = ImHasFlag(plot.Flags, ImPlotFlags_Legend) ? gp.Hov_Frame && plot.BB_Legend.Contains(IO.MousePos) : false;
         // render legend box
@@ -1545,18 +2244,29 @@ void EndPlot() {
         ImU32  col_txt_dis = ImGui::GetColorU32(col_txt * ImVec4(1,1,1,0.25f));
         DrawList.AddRectFilled(plot.BB_Legend.Min, plot.BB_Legend.Max, col_bg);
         DrawList.AddRect(plot.BB_Legend.Min, plot.BB_Legend.Max, col_bd);
-        // render each legend item
-        for (int i = 0; i < nItems; ++i) {
+        // the highlighted item may have been scrolled or filtered out of view
+        if (plot.LegendHighlight != -1 && plot.LegendHighlight < plot.Items.GetSize())
+            plot.Items.GetByIndex(plot.LegendHighlight)->Highlight = false;
+        plot.LegendHighlight = -1;
+        // render the legend items that are in view
+        const int first = (int)(plot.LegendScroll / txt_ht);
+        const int last  = ImMin(nEntries, (int)((plot.LegendScroll + legend_ht) / txt_ht) + 1);
+        if (scroll)
+            DrawList.PushClipRect(plot.BB_Legend.Min, plot.BB_Legend.Max, true);
+        for (int e = first; e < last; ++e) {
+            const int i = plot.LegendEntries[e];
+            const float y = e * txt_ht - plot.LegendScroll;
             ImPlotItem* item = GetItem(i);
             ImRect icon_bb;
-            icon_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(2, 2);
-            icon_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(legend_icon_size - 2, legend_icon_size - 2);
+            icon_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, y) + ImVec2(2, 2);
+            icon_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, y) + ImVec2(legend_icon_size - 2, legend_icon_size - 2);
             ImRect label_bb;
-            label_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(2, 2);
-            label_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, i * txt_ht) + ImVec2(legend_content_bb.Max.x, legend_icon_size - 2);
+            label_bb.Min = legend_content_bb.Min + legend_spacing + ImVec2(0, y) + ImVec2(2, 2);
+            label_bb.Max = legend_content_bb.Min + legend_spacing + ImVec2(0, y) + ImVec2(legend_content_bb.Max.x, legend_icon_size - 2);
             ImU32 col_hl_txt;
             if (ImHasFlag(plot.Flags, ImPlotFlags_Highlight) && hov_legend && (icon_bb.Contains(IO.MousePos) || label_bb.Contains(IO.MousePos))) {
                 item->Highlight = true;
+                plot.LegendHighlight = plot.Items.GetIndex(item);
                 col_hl_txt = ImGui::GetColorU32(ImLerp(col_txt, item->Color, 0.25f));
             }
             else
@@ -1579,8 +2289,17 @@ void EndPlot() {
             const char* label = GetLegendLabel(i);
             const char* text_display_end = ImGui::FindRenderedTextEnd(label, NULL);
             if (label != text_display_end)
-                DrawList.AddText(legend_content_bb.Min + legend_spacing + ImVec2(legend_icon_size, i * txt_ht), item->Show ? col_hl_txt  : col_txt_dis, label, text_display_end);
+                DrawList.AddText(legend_content_bb.Min + legend_spacing + ImVec2(legend_icon_size, y), item->Show ? col_hl_txt  : col_txt_dis, label, text_display_end);
         }
+        // render scroll bar
+        if (scroll && plot.LegendScrollMax > 0) {
+            const float track_ht = plot.BB_Legend.GetHeight() - 4;
+            const float grab_ht  = ImMax(txt_ht * 0.5f, track_ht * legend_ht / (nEntries * txt_ht));
+            const float grab_y   = plot.BB_Legend.Min.y + 2 + (track_ht - grab_ht) * plot.LegendScroll / plot.LegendScrollMax;
+            DrawList.AddRectFilled(ImVec2(plot.BB_Legend.Max.x - 5, grab_y), ImVec2(plot.BB_Legend.Max.x - 2, grab_y + grab_ht), ImGui::GetColorU32(ImGuiCol_ScrollbarGrab));
+        }
+        if (scroll)
+            DrawList.PopClipRect();
     }
 
     // render crosshairs
@@ -1612,6 +2331,12 @@ void EndPlot() {
         if (ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LogScale)) {
             writer.Write("%.3E", gp.MousePos[0].x);
         }
+        else if (ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_Time)) {
+            double range_x = gp.XTicks.Size > 1 ? (gp.XTicks[1].PlotPos - gp.XTicks[0].PlotPos) : plot.XAxis.Range.Size();
+            double scale;
+            const char* unit = TimeUnit(range_x, &scale);
+            writer.Write("%.*f %s", Precision(range_x * scale), gp.MousePos[0].x * scale, unit);
+        }
         else {
             double range_x = gp.XTicks.Size > 1 ? (gp.XTicks[1].PlotPos - gp.XTicks[0].PlotPos) : plot.XAxis.Range.Size();
             writer.Write("%.*f", Precision(range_x), gp.MousePos[0].x);
@@ -1756,6 +2481,15 @@ void SetNextPlotLimitsY(double y_min, double y_max, ImGuiCond cond, int y_axis)
     gp.NextPlotData.Y[y_axis].Max = y_max;
 }
 
+void SetNextPlotTimeOrigin(ImS64 origin_ns, ImGuiCond cond) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == NULL, "SetNextPlotTimeOrigin() needs to be called before BeginPlot()!");
+    IM_ASSERT(cond == 0 || ImIsPowerOfTwo(cond)); // Make sure the user doesn't attempt to combine multiple condition flags.
+    gp.NextPlotData.HasTimeOrigin  = true;
+    gp.NextPlotData.TimeOriginCond = cond;
+    gp.NextPlotData.TimeOrigin     = origin_ns;
+}
+
 void FitNextPlotAxes(bool x, bool y, bool y2, bool y3) {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot == NULL, "FitNextPlotAxes() needs to be called before BeginPlot()!");
@@ -1794,6 +2528,27 @@ void SetNextPlotTicksY(double y_min, double y_max, int n_ticks, const char** lab
     SetNextPlotTicksY(&buffer[0], n_ticks, labels, show_default,y_axis);
 }
 
+void SetNextItemDataVersion(int version) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "SetNextItemDataVersion() needs to be called between BeginPlot() and EndPlot()!");
+    IM_ASSERT_USER_ERROR(version >= 0, "Data versions must be non-negative!");
+    gp.NextItemDataVersion = version;
+}
+
+int GetItemDrawCmdCount(const char* label_id) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "GetItemDrawCmdCount() needs to be called between BeginPlot() and EndPlot()!");
+    EndItemDrawCmds(*gp.CurrentPlot);
+    ImPlotItem* item = gp.CurrentPlot->Items.GetByKey(ImGui::GetID(label_id));
+    return item != NULL ? item->DrawCmdCount : -1;
+}
+
+void SetNextItemDataFinite() {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "SetNextItemDataFinite() needs to be called between BeginPlot() and EndPlot()!");
+    gp.NextItemDataFinite = true;
+}
+
 void SetPlotYAxis(int y_axis) {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "SetPlotYAxis() needs to be called between BeginPlot() and EndPlot()!");
@@ -1871,6 +2626,12 @@ bool IsPlotQueried() {
     return gp.CurrentPlot->Queried;
 }
 
+ImS64 GetPlotTimeOrigin() {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "GetPlotTimeOrigin() needs to be called between BeginPlot() and EndPlot()!");
+    return gp.CurrentPlot->TimeOrigin;
+}
+
 ImPlotLimits GetPlotQuery(int y_axis_in) {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(y_axis_in >= -1 && y_axis_in < IMPLOT_Y_AXES, "y_axis needs to between -1 and IMPLOT_Y_AXES");
@@ -2341,6 +3102,7 @@ void ShowStyleEditor(ImPlotStyle* ref) {
             ImGui::SliderFloat("ErrorBarWeight", &style.ErrorBarWeight, 0.0f, 5.0f, "%.1f");
             ImGui::SliderFloat("DigitalBitHeight", &style.DigitalBitHeight, 0.0f, 20.0f, "%.1f");
             ImGui::SliderFloat("DigitalBitGap", &style.DigitalBitGap, 0.0f, 20.0f, "%.1f");
+            ImGui::SliderFloat("LineSimplify", &style.LineSimplify, 0.0f, 2.0f, "%.2f");
             ImGui::Text("Plot Styling");
             ImGui::SliderFloat("PlotBorderSize", &style.PlotBorderSize, 0.0f, 2.0f, "%.0f");
             ImGui::SliderFloat("MinorAlpha", &style.MinorAlpha, 0.0f, 1.0f, "%.2f");
@@ -2557,6 +3319,7 @@ void ShowUserGuide() {
         ImGui::BulletText("Double right click on an axis to open the axis context menu.");
     ImGui::Unindent();
     ImGui::BulletText("Click legend label icons to show/hide plot items.");
+    ImGui::BulletText("Scroll scrollable legends with the mouse wheel and filter them from the context menu.");
 }
 
 
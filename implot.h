@@ -27,6 +27,12 @@
 
 #define IMPLOT_VERSION "0.5 WIP"
 
+// On LP64 platforms int64_t/uint64_t are usually long/unsigned long rather than long long (ImS64/ImU64). The 64-bit integer
+// plotting functions are then also declared for long/unsigned long so that <stdint.h> buffers can be passed without casts.
+#if (defined(__LP64__) || defined(_LP64)) && !defined(_WIN32)
+#define IMPLOT_LONG_IS_64BIT
+#endif
+
 //-----------------------------------------------------------------------------
 // Forward Declarations and Basic Types
 //-----------------------------------------------------------------------------
@@ -44,18 +50,19 @@ typedef int ImPlotColormap;    // -> enum ImPlotColormap_
 
 // Options for plots.
 enum ImPlotFlags_ {
-    ImPlotFlags_MousePos    = 1 << 0,  // the mouse position, in plot coordinates, will be displayed in the bottom-right
-    ImPlotFlags_Legend      = 1 << 1,  // a legend will be displayed in the top-left
-    ImPlotFlags_Highlight   = 1 << 2,  // plot items will be highlighted when their legend entry is hovered
-    ImPlotFlags_BoxSelect   = 1 << 3,  // the user will be able to box-select with right-mouse
-    ImPlotFlags_Query       = 1 << 4,  // the user will be able to draw query rects with middle-mouse
-    ImPlotFlags_ContextMenu = 1 << 5,  // the user will be able to open context menus with double-right click
-    ImPlotFlags_Crosshairs  = 1 << 6,  // the default mouse cursor will be replaced with a crosshair when hovered
-    ImPlotFlags_AntiAliased = 1 << 7,  // plot lines will be software anti-aliased (not recommended, prefer MSAA)
-    ImPlotFlags_NoChild     = 1 << 8,  // a child window region will not be used to capture mouse scroll (can boost performance for single ImGui window applications)
-    ImPlotFlags_YAxis2      = 1 << 9,  // enable a 2nd y-axis
-    ImPlotFlags_YAxis3      = 1 << 10, // enable a 3rd y-axis
-    ImPlotFlags_Default     = ImPlotFlags_MousePos | ImPlotFlags_Legend | ImPlotFlags_Highlight | ImPlotFlags_BoxSelect | ImPlotFlags_ContextMenu
+    ImPlotFlags_MousePos     = 1 << 0,  // the mouse position, in plot coordinates, will be displayed in the bottom-right
+    ImPlotFlags_Legend       = 1 << 1,  // a legend will be displayed in the top-left
+    ImPlotFlags_Highlight    = 1 << 2,  // plot items will be highlighted when their legend entry is hovered
+    ImPlotFlags_BoxSelect    = 1 << 3,  // the user will be able to box-select with right-mouse
+    ImPlotFlags_Query        = 1 << 4,  // the user will be able to draw query rects with middle-mouse
+    ImPlotFlags_ContextMenu  = 1 << 5,  // the user will be able to open context menus with double-right click
+    ImPlotFlags_Crosshairs   = 1 << 6,  // the default mouse cursor will be replaced with a crosshair when hovered
+    ImPlotFlags_AntiAliased  = 1 << 7,  // plot lines will be software anti-aliased (not recommended, prefer MSAA)
+    ImPlotFlags_NoChild      = 1 << 8,  // a child window region will not be used to capture mouse scroll (can boost performance for single ImGui window applications)
+    ImPlotFlags_YAxis2       = 1 << 9,  // enable a 2nd y-axis
+    ImPlotFlags_YAxis3       = 1 << 10, // enable a 3rd y-axis
+    ImPlotFlags_LegendScroll = 1 << 11, // the legend will be clipped to the plot area, scrolled with the mouse wheel, and filterable from the context menu (use with many items)
+    ImPlotFlags_Default      = ImPlotFlags_MousePos | ImPlotFlags_Legend | ImPlotFlags_Highlight | ImPlotFlags_BoxSelect | ImPlotFlags_ContextMenu
 };
 
 // Options for plot axes (X and Y).
@@ -68,6 +75,7 @@ enum ImPlotAxisFlags_ {
     ImPlotAxisFlags_LockMax    = 1 << 5, // the axis maximum value will be locked when panning/zooming
     ImPlotAxisFlags_LogScale   = 1 << 6, // a logartithmic (base 10) axis scale will be used
     ImPlotAxisFlags_Scientific = 1 << 7, // scientific notation will be used for tick labels if displayed (WIP, not very good yet)
+    ImPlotAxisFlags_Time       = 1 << 8, // values are seconds relative to the plot's time origin and ticks will be placed and labeled in time units (X-axis only, see PlotLineTime)
     ImPlotAxisFlags_Default    = ImPlotAxisFlags_GridLines | ImPlotAxisFlags_TickMarks | ImPlotAxisFlags_TickLabels,
     ImPlotAxisFlags_Auxiliary  = ImPlotAxisFlags_TickMarks | ImPlotAxisFlags_TickLabels,
 };
@@ -115,6 +123,7 @@ enum ImPlotStyleVar_ {
     ImPlotStyleVar_ErrorBarWeight,   // float,  error bar whisker weight in pixels
     ImPlotStyleVar_DigitalBitHeight, // float,  digital channels bit height (at 1) in pixels
     ImPlotStyleVar_DigitalBitGap,    // float,  digital channels bit padding gap in pixels
+    ImPlotStyleVar_LineSimplify,     // float,  line simplification tolerance in pixels (0 = off)
     // plot styling variables
     ImPlotStyleVar_PlotBorderSize,   // float,  thickness of border around plot area
     ImPlotStyleVar_MinorAlpha,       // float,  alpha multiplier applied to minor axis grid lines
@@ -191,6 +200,106 @@ struct ImPlotLimits {
     bool Contains(double x, double y) const   { return X.Contains(x) && Y.Contains(y); }
 };
 
+// Persistent handle to a plot item, obtained once with GetItemHandle() and valid across frames for the plot it was created in.
+struct ImPlotItemHandle {
+    ImGuiID ID;    // item ID (hash of the label_id it was created with)
+    int     Index; // index of the item in its plot's item pool
+    ImPlotItemHandle() { ID = 0; Index = -1; }
+};
+
+// Read-only memory mapping of a flat binary file. Opening does not read the file; pages are faulted in only when touched (see PlotLineMapped).
+struct ImPlotMappedFile {
+    const void* Data;   // start of the mapped file, or NULL if not open
+    size_t      Size;   // size of the mapped file in bytes
+    void*       Handle; // platform specific mapping handle
+    ImPlotMappedFile() { Data = NULL; Size = 0; Handle = NULL; }
+    ~ImPlotMappedFile() { Close(); }
+    bool Open(const char* filename);
+    void Close();
+    bool IsOpen() const { return Data != NULL; }
+private:
+    ImPlotMappedFile(const ImPlotMappedFile&);
+    ImPlotMappedFile& operator=(const ImPlotMappedFile&);
+};
+
+// Data source callback for PlotLineProvider. Append the (decimated) points for the X range [x_min, x_max] drawn across #pixel_width pixels to #out
+// and return true, or return false if they are not ready yet (e.g. still loading on another thread) and the request will be repeated next frame.
+typedef bool (*ImPlotDataProvider)(void* user_data, double x_min, double x_max, int pixel_width, ImVector<ImPlotPoint>* out);
+
+// Data source callback for PlotLineBatch. Fill xs[i] and ys[i] with the point at index #idx + i for i in [0, #count).
+typedef void (*ImPlotBatchGetter)(void* data, int idx, int count, double* xs, double* ys);
+
+// Summary of one block of an ImPlotCompressedSeries.
+struct ImPlotCompressedBlock {
+    int    ByteOffset; // start of the block in the byte stream
+    int    Count;      // number of points in the block
+    ImS64  XMin, XMax; // first and last X ticks of the block
+    double YMin, YMax; // Y extents of the block (NaNs are ignored)
+};
+
+// Compressed time series in the style of Gorilla. X ticks are stored as delta-of-deltas and Y values either losslessly as the XOR with
+// the previous value or, if #y_quantum > 0, rounded to multiples of it and stored as delta-of-deltas too (error <= y_quantum / 2,
+// non-finite values are kept exactly). Regularly sampled, smooth data packs into a few bits per point. Points are split into
+// independently decodable blocks that keep their X range and Y extents, so PlotLineCompressed only decodes the blocks in view and
+// draws blocks narrower than a pixel from their summary alone. X ticks must be increasing and are plotted as (x - XOrigin) * XScale
+// (e.g. XScale = 1e-9 for nanosecond timestamps).
+struct ImPlotCompressedSeries {
+    ImVector<ImU8>                  Bytes;     // encoded bit stream, each block starts on a byte boundary
+    ImVector<ImPlotCompressedBlock> Blocks;    // block index
+    ImS64                           Count;     // total number of points
+    int                             BlockSize; // number of points per block
+    double                          XScale;    // plot units per X tick
+    ImS64                           XOrigin;   // X tick plotted at zero
+    double                          YQuantum;  // Y resolution, or 0 for lossless Y values
+    ImPlotCompressedSeries(int block_size = 1024, double x_scale = 1, ImS64 x_origin = 0, double y_quantum = 0);
+    // Appends a point. X must not be less than the X of the previous point.
+    void AddPoint(ImS64 x, double y);
+    // Removes all points.
+    void Clear();
+    // Decodes the points of block #block and appends them to #out.
+    void DecodeBlock(int block, ImVector<ImPlotPoint>* out) const;
+    // Converts an X tick to plot units.
+    double GetX(ImS64 x) const { return (double)(x - XOrigin) * XScale; }
+    // Encoder state
+    int    BitFill;            // bits used in the last byte
+    ImS64  PrevX, PrevDelta;
+    ImU64  PrevY;
+    int    PrevLead, PrevTrail;
+    ImS64  PrevQ, PrevQDelta;
+};
+
+// Encoding of one block of an ImPlotQuantizedSeries (y = Offset + q * Scale).
+struct ImPlotQuantizedBlock {
+    int    ByteOffset; // start of the block in the byte stream
+    int    Width;      // bytes per sample, 1 or 2
+    double Offset;     // minimum of the block
+    double Scale;      // step between two quantization levels
+};
+
+// Lossy series storage with uniformly spaced X values (x = X0 + idx * Dx). Y values are buffered until #BlockSize of them are
+// available, then stored as 8-bit or 16-bit codes with a per-block offset and scale. A block uses 8 bits if that keeps the rounding
+// error within #MaxError (e.g. the Y span of one pixel at the deepest zoom you need) and 16 bits otherwise, in which case the error
+// is at most half of the block's value range / 65534. Non-finite values are reserved a code and read back as NaN.
+struct ImPlotQuantizedSeries {
+    ImVector<ImU8>                 Bytes;     // quantized samples of all blocks
+    ImVector<ImPlotQuantizedBlock> Blocks;    // block index
+    ImVector<double>               Pending;   // samples of the incomplete last block, stored as is
+    int                            BlockSize; // number of samples per block
+    double                         MaxError;  // rounding error allowed for 8-bit blocks, or 0 to always use 16 bits
+    double                         X0, Dx;    // X value of the first sample and spacing between samples
+    ImPlotQuantizedSeries(double max_error = 0, double x0 = 0, double dx = 1, int block_size = 256);
+    // Appends values.
+    void AddPoint(double y);
+    void AddPoints(const float* values, int count)  { for (int i = 0; i < count; ++i) AddPoint((double)values[i]); }
+    void AddPoints(const double* values, int count) { for (int i = 0; i < count; ++i) AddPoint(values[i]); }
+    // Removes all values.
+    void Clear();
+    // Returns the number of values.
+    int GetCount() const { return Blocks.Size * BlockSize + Pending.Size; }
+private:
+    void FlushBlock();
+};
+
 // Plot style structure
 struct ImPlotStyle {
     // item styling variables
@@ -203,6 +312,7 @@ struct ImPlotStyle {
     float        ErrorBarWeight;          // = 1.5,    error bar whisker weight in pixels
     float        DigitalBitHeight;        // = 8,      digital channels bit height (at y = 1.0f) in pixels
     float        DigitalBitGap;           // = 4,      digital channels bit padding gap in pixels
+    float        LineSimplify;            // = 0,      line simplification tolerance in pixels (0 = off)
     // plot styling variables
     float        PlotBorderSize;          // = 1,      line thickness of border around plot area
     float        MinorAlpha;              // = 0.25    alpha multiplier applied to minor axis grid lines
@@ -284,6 +394,11 @@ void EndPlot();
 // Plot Items
 //-----------------------------------------------------------------------------
 
+// The functions below take a #label_id which is hashed and looked up each frame. For plots with many items, you can instead
+// obtain a persistent ImPlotItemHandle once and pass it to the handle overloads of PlotLine, PlotScatter, etc. This skips
+// label hashing and string handling. Must be called between BeginPlot() and EndPlot().
+ImPlotItemHandle GetItemHandle(const char* label_id);
+
 // Plots a standard 2D line plot.
 void PlotLine(const char* label_id, const float* values, int count, int offset = 0, int stride = sizeof(float));
 void PlotLine(const char* label_id, const double* values, int count, int offset = 0, int stride = sizeof(double));
@@ -292,6 +407,85 @@ void PlotLine(const char* label_id, const double* xs, const double* ys, int coun
 void PlotLine(const char* label_id, const ImVec2* data, int count, int offset = 0);
 void PlotLine(const char* label_id, const ImPlotPoint* data, int count, int offset = 0);
 void PlotLine(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
+void PlotLine(const ImPlotItemHandle& handle, const float* values, int count, int offset = 0, int stride = sizeof(float));
+void PlotLine(const ImPlotItemHandle& handle, const double* values, int count, int offset = 0, int stride = sizeof(double));
+void PlotLine(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, int offset = 0, int stride = sizeof(float));
+void PlotLine(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, int offset = 0, int stride = sizeof(double));
+void PlotLine(const ImPlotItemHandle& handle, const ImVec2* data, int count, int offset = 0);
+void PlotLine(const ImPlotItemHandle& handle, const ImPlotPoint* data, int count, int offset = 0);
+void PlotLine(const ImPlotItemHandle& handle, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
+
+// Plots a standard 2D line plot from a window of #count points starting at index #start of ring buffers holding #capacity points.
+// The window may wrap around the end of the buffers (see ImPlotStreamBuffer in implot_streaming.h).
+void PlotLineRing(const char* label_id, const float* xs, const float* ys, int capacity, int start, int count, int stride = sizeof(float));
+void PlotLineRing(const char* label_id, const double* xs, const double* ys, int capacity, int start, int count, int stride = sizeof(double));
+
+// Plots a standard 2D line plot with 64-bit sample counts and offsets. Above INT_MAX samples, the data is reduced to the min and max Y
+// of consecutive buckets of samples, so extremes are kept but not every sample is drawn. 64-bit variants exist for lines and scatters only.
+void PlotLine64(const char* label_id, const float* values, ImS64 count, ImS64 offset = 0, int stride = sizeof(float));
+void PlotLine64(const char* label_id, const double* values, ImS64 count, ImS64 offset = 0, int stride = sizeof(double));
+void PlotLine64(const char* label_id, const float* xs, const float* ys, ImS64 count, ImS64 offset = 0, int stride = sizeof(float));
+void PlotLine64(const char* label_id, const double* xs, const double* ys, ImS64 count, ImS64 offset = 0, int stride = sizeof(double));
+
+// Plots a standard 2D line plot from uniformly sampled values where X is implicit (x = x0 + idx * dx). Only samples within the visible X range are visited.
+void PlotLineUniform(const char* label_id, const float* values, int count, double x0, double dx, int offset = 0, int stride = sizeof(float));
+void PlotLineUniform(const char* label_id, const double* values, int count, double x0, double dx, int offset = 0, int stride = sizeof(double));
+
+// Plots a standard 2D line plot from integer data in place. Y values are plotted as (y * scale + bias).
+void PlotLine(const char* label_id, const ImS8*  values, int count, int offset = 0, int stride = sizeof(ImS8),  double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU8*  values, int count, int offset = 0, int stride = sizeof(ImU8),  double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImS16* values, int count, int offset = 0, int stride = sizeof(ImS16), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU16* values, int count, int offset = 0, int stride = sizeof(ImU16), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImS32* values, int count, int offset = 0, int stride = sizeof(ImS32), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU32* values, int count, int offset = 0, int stride = sizeof(ImU32), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImS64* values, int count, int offset = 0, int stride = sizeof(ImS64), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU64* values, int count, int offset = 0, int stride = sizeof(ImU64), double scale = 1, double bias = 0);
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotLine(const char* label_id, const long* values, int count, int offset = 0, int stride = sizeof(long), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const unsigned long* values, int count, int offset = 0, int stride = sizeof(unsigned long), double scale = 1, double bias = 0);
+#endif
+void PlotLine(const char* label_id, const ImS8*  xs, const ImS8*  ys, int count, int offset = 0, int stride = sizeof(ImS8),  double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU8*  xs, const ImU8*  ys, int count, int offset = 0, int stride = sizeof(ImU8),  double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImS16* xs, const ImS16* ys, int count, int offset = 0, int stride = sizeof(ImS16), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU16* xs, const ImU16* ys, int count, int offset = 0, int stride = sizeof(ImU16), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImS32* xs, const ImS32* ys, int count, int offset = 0, int stride = sizeof(ImS32), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU32* xs, const ImU32* ys, int count, int offset = 0, int stride = sizeof(ImU32), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImS64* xs, const ImS64* ys, int count, int offset = 0, int stride = sizeof(ImS64), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const ImU64* xs, const ImU64* ys, int count, int offset = 0, int stride = sizeof(ImU64), double scale = 1, double bias = 0);
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotLine(const char* label_id, const long* xs, const long* ys, int count, int offset = 0, int stride = sizeof(long), double scale = 1, double bias = 0);
+void PlotLine(const char* label_id, const unsigned long* xs, const unsigned long* ys, int count, int offset = 0, int stride = sizeof(unsigned long), double scale = 1, double bias = 0);
+#endif
+
+// Plots a standard 2D line plot from X and Y columns with independent types (ImGuiDataType_) and byte strides, e.g. fields of interleaved records read in place.
+void PlotLineScalar(const char* label_id, ImGuiDataType x_type, const void* xs, int x_stride, ImGuiDataType y_type, const void* ys, int y_stride, int count, int offset = 0);
+
+// Plots a standard 2D line plot from samples of #type stored in a memory mapped file, starting #header bytes in and #stride bytes apart (x = x0 + idx * dx).
+// Only the visible range is read, decimated to about two samples per pixel, so only the pages touched are ever loaded from disk.
+void PlotLineMapped(const char* label_id, const ImPlotMappedFile& file, ImGuiDataType type, size_t header, int stride, double x0 = 0, double dx = 1);
+
+// Plots a standard 2D line plot from points pulled from #provider for the current view. Results are cached per item and the provider is only called
+// again when the X range, plot width or data version (see SetNextItemDataVersion) changes. Until a request completes, the last result is drawn.
+void PlotLineProvider(const char* label_id, ImPlotDataProvider provider, void* user_data = NULL);
+
+// Plots a standard 2D line plot from a batch getter callback, which is asked for chunks of consecutive points rather than one point per call.
+void PlotLineBatch(const char* label_id, ImPlotBatchGetter getter, void* data, int count, int offset = 0);
+
+// Plots a standard 2D line plot from a compressed series (see ImPlotCompressedSeries). Fitting uses the block summaries, and only the
+// blocks overlapping the X axis range are decoded; blocks narrower than a pixel are drawn as their min/max extents without decoding.
+void PlotLineCompressed(const char* label_id, const ImPlotCompressedSeries& series);
+
+// Plots a standard 2D line plot from a quantized series (see ImPlotQuantizedSeries), dequantizing only the samples within the X axis range.
+void PlotLineQuantized(const char* label_id, const ImPlotQuantizedSeries& series);
+
+// Plots a standard 2D line plot from int64 nanosecond timestamps. The plot's time origin is subtracted in integer space before conversion,
+// so X values are seconds relative to it and keep nanosecond resolution. Use with ImPlotAxisFlags_Time on the X axis.
+void PlotLineTime(const char* label_id, const ImS64* ts_ns, const float* ys, int count, int offset = 0, int ts_stride = sizeof(ImS64), int y_stride = sizeof(float));
+void PlotLineTime(const char* label_id, const ImS64* ts_ns, const double* ys, int count, int offset = 0, int ts_stride = sizeof(ImS64), int y_stride = sizeof(double));
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotLineTime(const char* label_id, const long* ts_ns, const float* ys, int count, int offset = 0, int ts_stride = sizeof(long), int y_stride = sizeof(float));
+void PlotLineTime(const char* label_id, const long* ts_ns, const double* ys, int count, int offset = 0, int ts_stride = sizeof(long), int y_stride = sizeof(double));
+#endif
 
 // Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle.
 void PlotScatter(const char* label_id, const float* values, int count, int offset = 0, int stride = sizeof(float));
@@ -301,6 +495,66 @@ void PlotScatter(const char* label_id, const double* xs, const double* ys, int c
 void PlotScatter(const char* label_id, const ImVec2* data, int count, int offset = 0);
 void PlotScatter(const char* label_id, const ImPlotPoint* data, int count, int offset = 0);
 void PlotScatter(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
+void PlotScatter(const ImPlotItemHandle& handle, const float* values, int count, int offset = 0, int stride = sizeof(float));
+void PlotScatter(const ImPlotItemHandle& handle, const double* values, int count, int offset = 0, int stride = sizeof(double));
+void PlotScatter(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, int offset = 0, int stride = sizeof(float));
+void PlotScatter(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, int offset = 0, int stride = sizeof(double));
+void PlotScatter(const ImPlotItemHandle& handle, const ImVec2* data, int count, int offset = 0);
+void PlotScatter(const ImPlotItemHandle& handle, const ImPlotPoint* data, int count, int offset = 0);
+void PlotScatter(const ImPlotItemHandle& handle, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
+
+// Plots a standard 2D scatter plot from a window of ring buffers (see PlotLineRing).
+void PlotScatterRing(const char* label_id, const float* xs, const float* ys, int capacity, int start, int count, int stride = sizeof(float));
+void PlotScatterRing(const char* label_id, const double* xs, const double* ys, int capacity, int start, int count, int stride = sizeof(double));
+
+// Plots a standard 2D scatter plot with 64-bit sample counts and offsets. Every sample is drawn, no matter the count.
+void PlotScatter64(const char* label_id, const float* values, ImS64 count, ImS64 offset = 0, int stride = sizeof(float));
+void PlotScatter64(const char* label_id, const double* values, ImS64 count, ImS64 offset = 0, int stride = sizeof(double));
+void PlotScatter64(const char* label_id, const float* xs, const float* ys, ImS64 count, ImS64 offset = 0, int stride = sizeof(float));
+void PlotScatter64(const char* label_id, const double* xs, const double* ys, ImS64 count, ImS64 offset = 0, int stride = sizeof(double));
+
+// Plots a standard 2D scatter plot from integer data in place. Y values are plotted as (y * scale + bias).
+void PlotScatter(const char* label_id, const ImS8*  values, int count, int offset = 0, int stride = sizeof(ImS8),  double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU8*  values, int count, int offset = 0, int stride = sizeof(ImU8),  double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImS16* values, int count, int offset = 0, int stride = sizeof(ImS16), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU16* values, int count, int offset = 0, int stride = sizeof(ImU16), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImS32* values, int count, int offset = 0, int stride = sizeof(ImS32), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU32* values, int count, int offset = 0, int stride = sizeof(ImU32), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImS64* values, int count, int offset = 0, int stride = sizeof(ImS64), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU64* values, int count, int offset = 0, int stride = sizeof(ImU64), double scale = 1, double bias = 0);
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotScatter(const char* label_id, const long* values, int count, int offset = 0, int stride = sizeof(long), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const unsigned long* values, int count, int offset = 0, int stride = sizeof(unsigned long), double scale = 1, double bias = 0);
+#endif
+void PlotScatter(const char* label_id, const ImS8*  xs, const ImS8*  ys, int count, int offset = 0, int stride = sizeof(ImS8),  double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU8*  xs, const ImU8*  ys, int count, int offset = 0, int stride = sizeof(ImU8),  double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImS16* xs, const ImS16* ys, int count, int offset = 0, int stride = sizeof(ImS16), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU16* xs, const ImU16* ys, int count, int offset = 0, int stride = sizeof(ImU16), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImS32* xs, const ImS32* ys, int count, int offset = 0, int stride = sizeof(ImS32), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU32* xs, const ImU32* ys, int count, int offset = 0, int stride = sizeof(ImU32), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImS64* xs, const ImS64* ys, int count, int offset = 0, int stride = sizeof(ImS64), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const ImU64* xs, const ImU64* ys, int count, int offset = 0, int stride = sizeof(ImU64), double scale = 1, double bias = 0);
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotScatter(const char* label_id, const long* xs, const long* ys, int count, int offset = 0, int stride = sizeof(long), double scale = 1, double bias = 0);
+void PlotScatter(const char* label_id, const unsigned long* xs, const unsigned long* ys, int count, int offset = 0, int stride = sizeof(unsigned long), double scale = 1, double bias = 0);
+#endif
+
+// Plots a standard 2D scatter plot from X and Y columns with independent types (ImGuiDataType_) and byte strides.
+void PlotScatterScalar(const char* label_id, ImGuiDataType x_type, const void* xs, int x_stride, ImGuiDataType y_type, const void* ys, int y_stride, int count, int offset = 0);
+
+// Plots a standard 2D scatter plot from a batch getter callback (see PlotLineBatch).
+void PlotScatterBatch(const char* label_id, ImPlotBatchGetter getter, void* data, int count, int offset = 0);
+
+// Plots a standard 2D scatter plot from points pulled from #provider for the current view (see PlotLineProvider).
+void PlotScatterProvider(const char* label_id, ImPlotDataProvider provider, void* user_data = NULL);
+
+// Plots a standard 2D scatter plot from int64 nanosecond timestamps (see PlotLineTime).
+void PlotScatterTime(const char* label_id, const ImS64* ts_ns, const float* ys, int count, int offset = 0, int ts_stride = sizeof(ImS64), int y_stride = sizeof(float));
+void PlotScatterTime(const char* label_id, const ImS64* ts_ns, const double* ys, int count, int offset = 0, int ts_stride = sizeof(ImS64), int y_stride = sizeof(double));
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotScatterTime(const char* label_id, const long* ts_ns, const float* ys, int count, int offset = 0, int ts_stride = sizeof(long), int y_stride = sizeof(float));
+void PlotScatterTime(const char* label_id, const long* ts_ns, const double* ys, int count, int offset = 0, int ts_stride = sizeof(long), int y_stride = sizeof(double));
+#endif
 
 // Plots a shaded (filled) region between two lines, or a line and a horizontal reference.
 void PlotShaded(const char* label_id, const float* values, int count, float y_ref = 0, int offset = 0, int stride = sizeof(float));
@@ -310,6 +564,17 @@ void PlotShaded(const char* label_id, const double* xs, const double* ys, int co
 void PlotShaded(const char* label_id, const float* xs, const float* ys1, const float* ys2, int count, int offset = 0, int stride = sizeof(float));
 void PlotShaded(const char* label_id, const double* xs, const double* ys1, const double* ys2, int count, int offset = 0, int stride = sizeof(double));
 void PlotShaded(const char* label_id, ImPlotPoint (*getter1)(void* data, int idx), void* data1, ImPlotPoint (*getter2)(void* data, int idx), void* data2, int count, int offset = 0);
+void PlotShaded(const ImPlotItemHandle& handle, const float* values, int count, float y_ref = 0, int offset = 0, int stride = sizeof(float));
+void PlotShaded(const ImPlotItemHandle& handle, const double* values, int count, double y_ref = 0, int offset = 0, int stride = sizeof(double));
+void PlotShaded(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, float y_ref = 0, int offset = 0, int stride = sizeof(float));
+void PlotShaded(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, double y_ref = 0, int offset = 0, int stride = sizeof(double));
+void PlotShaded(const ImPlotItemHandle& handle, const float* xs, const float* ys1, const float* ys2, int count, int offset = 0, int stride = sizeof(float));
+void PlotShaded(const ImPlotItemHandle& handle, const double* xs, const double* ys1, const double* ys2, int count, int offset = 0, int stride = sizeof(double));
+void PlotShaded(const ImPlotItemHandle& handle, ImPlotPoint (*getter1)(void* data, int idx), void* data1, ImPlotPoint (*getter2)(void* data, int idx), void* data2, int count, int offset = 0);
+
+// Plots a shaded (filled) region between uniformly sampled values (x = x0 + idx * dx) and a horizontal reference line.
+void PlotShadedUniform(const char* label_id, const float* values, int count, double x0, double dx, double y_ref = 0, int offset = 0, int stride = sizeof(float));
+void PlotShadedUniform(const char* label_id, const double* values, int count, double x0, double dx, double y_ref = 0, int offset = 0, int stride = sizeof(double));
 
 // Plots a vertical bar graph. #width and #shift are in X units.
 void PlotBars(const char* label_id, const float* values, int count, float width = 0.67f, float shift = 0, int offset = 0, int stride = sizeof(float));
@@ -317,6 +582,11 @@ void PlotBars(const char* label_id, const double* values, int count, double widt
 void PlotBars(const char* label_id, const float* xs, const float* ys, int count, float width, int offset = 0, int stride = sizeof(float));
 void PlotBars(const char* label_id, const double* xs, const double* ys, int count, double width, int offset = 0, int stride = sizeof(double));
 void PlotBars(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, double width, int offset = 0);
+void PlotBars(const ImPlotItemHandle& handle, const float* values, int count, float width = 0.67f, float shift = 0, int offset = 0, int stride = sizeof(float));
+void PlotBars(const ImPlotItemHandle& handle, const double* values, int count, double width = 0.67f, double shift = 0, int offset = 0, int stride = sizeof(double));
+void PlotBars(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, float width, int offset = 0, int stride = sizeof(float));
+void PlotBars(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, double width, int offset = 0, int stride = sizeof(double));
+void PlotBars(const ImPlotItemHandle& handle, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, double width, int offset = 0);
 
 // Plots a horizontal bar graph. #height and #shift are in Y units.
 void PlotBarsH(const char* label_id, const float* values, int count, float height = 0.67f, float shift = 0, int offset = 0, int stride = sizeof(float));
@@ -324,18 +594,31 @@ void PlotBarsH(const char* label_id, const double* values, int count, double hei
 void PlotBarsH(const char* label_id, const float* xs, const float* ys, int count, float height,  int offset = 0, int stride = sizeof(float));
 void PlotBarsH(const char* label_id, const double* xs, const double* ys, int count, double height,  int offset = 0, int stride = sizeof(double));
 void PlotBarsH(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, double height,  int offset = 0);
+void PlotBarsH(const ImPlotItemHandle& handle, const float* values, int count, float height = 0.67f, float shift = 0, int offset = 0, int stride = sizeof(float));
+void PlotBarsH(const ImPlotItemHandle& handle, const double* values, int count, double height = 0.67f, double shift = 0, int offset = 0, int stride = sizeof(double));
+void PlotBarsH(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, float height,  int offset = 0, int stride = sizeof(float));
+void PlotBarsH(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, double height,  int offset = 0, int stride = sizeof(double));
+void PlotBarsH(const ImPlotItemHandle& handle, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, double height,  int offset = 0);
 
 // Plots vertical error bar. The label_id should be the same as the label_id of the associated line or bar plot.
 void PlotErrorBars(const char* label_id, const float* xs, const float* ys, const float* err, int count, int offset = 0, int stride = sizeof(float));
 void PlotErrorBars(const char* label_id, const double* xs, const double* ys, const double* err, int count, int offset = 0, int stride = sizeof(double));
 void PlotErrorBars(const char* label_id, const float* xs, const float* ys, const float* neg, const float* pos, int count, int offset = 0, int stride = sizeof(float));
 void PlotErrorBars(const char* label_id, const double* xs, const double* ys, const double* neg, const double* pos, int count, int offset = 0, int stride = sizeof(double));
+void PlotErrorBars(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* err, int count, int offset = 0, int stride = sizeof(float));
+void PlotErrorBars(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* err, int count, int offset = 0, int stride = sizeof(double));
+void PlotErrorBars(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* neg, const float* pos, int count, int offset = 0, int stride = sizeof(float));
+void PlotErrorBars(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* neg, const double* pos, int count, int offset = 0, int stride = sizeof(double));
 
 // Plots horizontal error bars. The label_id should be the same as the label_id of the associated line or bar plot.
 void PlotErrorBarsH(const char* label_id, const float* xs, const float* ys, const float* err, int count, int offset = 0, int stride = sizeof(float));
 void PlotErrorBarsH(const char* label_id, const double* xs, const double* ys, const double* err, int count, int offset = 0, int stride = sizeof(double));
 void PlotErrorBarsH(const char* label_id, const float* xs, const float* ys, const float* neg, const float* pos, int count, int offset = 0, int stride = sizeof(float));
 void PlotErrorBarsH(const char* label_id, const double* xs, const double* ys, const double* neg, const double* pos, int count, int offset = 0, int stride = sizeof(double));
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* err, int count, int offset = 0, int stride = sizeof(float));
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* err, int count, int offset = 0, int stride = sizeof(double));
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* neg, const float* pos, int count, int offset = 0, int stride = sizeof(float));
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* neg, const double* pos, int count, int offset = 0, int stride = sizeof(double));
 
 // Plots a pie chart. If the sum of values > 1 or normalize is true, each value will be normalized. Center and radius are in plot units. #label_fmt can be set to NULL for no labels.
 void PlotPieChart(const char** label_ids, const float* values, int count, float x, float y, float radius, bool normalize = false, const char* label_fmt = "%.1f", float angle0 = 90);
@@ -344,11 +627,20 @@ void PlotPieChart(const char** label_ids, const double* values, int count, doubl
 // Plots a 2D heatmap chart. Values are expected to be in row-major order. #label_fmt can be set to NULL for no labels.
 void PlotHeatmap(const char* label_id, const float* values, int rows, int cols, float scale_min, float scale_max, const char* label_fmt = "%.1f", const ImPlotPoint& bounds_min = ImPlotPoint(0,0), const ImPlotPoint& bounds_max = ImPlotPoint(1,1));
 void PlotHeatmap(const char* label_id, const double* values, int rows, int cols, double scale_min, double scale_max, const char* label_fmt = "%.1f", const ImPlotPoint& bounds_min = ImPlotPoint(0,0), const ImPlotPoint& bounds_max = ImPlotPoint(1,1));
+void PlotHeatmap(const ImPlotItemHandle& handle, const float* values, int rows, int cols, float scale_min, float scale_max, const char* label_fmt = "%.1f", const ImPlotPoint& bounds_min = ImPlotPoint(0,0), const ImPlotPoint& bounds_max = ImPlotPoint(1,1));
+void PlotHeatmap(const ImPlotItemHandle& handle, const double* values, int rows, int cols, double scale_min, double scale_max, const char* label_fmt = "%.1f", const ImPlotPoint& bounds_min = ImPlotPoint(0,0), const ImPlotPoint& bounds_max = ImPlotPoint(1,1));
 
 // Plots digital data. Digital plots do not respond to y drag or zoom, and are always referenced to the bottom of the plot.
 void PlotDigital(const char* label_id, const float* xs, const float* ys, int count, int offset = 0, int stride = sizeof(float));
 void PlotDigital(const char* label_id, const double* xs, const double* ys, int count, int offset = 0, int stride = sizeof(double));
 void PlotDigital(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
+void PlotDigital(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, int offset = 0, int stride = sizeof(float));
+void PlotDigital(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, int offset = 0, int stride = sizeof(double));
+void PlotDigital(const ImPlotItemHandle& handle, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset = 0);
+
+// Plots digital data from uniformly sampled values where X is implicit (x = x0 + idx * dx).
+void PlotDigitalUniform(const char* label_id, const float* values, int count, double x0, double dx, int offset = 0, int stride = sizeof(float));
+void PlotDigitalUniform(const char* label_id, const double* values, int count, double x0, double dx, int offset = 0, int stride = sizeof(double));
 
 // Plots a centered text label at point x,y with optional pixel offset. Text color can be changed with ImGui::PushStyleColor(ImGuiCol_Text, ...).
 void PlotText(const char* text, float x, float y, bool vertical = false, const ImVec2& pixel_offset = ImVec2(0,0));
@@ -364,6 +656,9 @@ void SetNextPlotLimits(double x_min, double x_max, double y_min, double y_max, I
 void SetNextPlotLimitsX(double x_min, double x_max, ImGuiCond cond = ImGuiCond_Once);
 // Set the Y axis range limits of the next plot. Call right before BeginPlot(). If ImGuiCond_Always is used, the Y axis limits will be locked.
 void SetNextPlotLimitsY(double y_min, double y_max, ImGuiCond cond = ImGuiCond_Once, int y_axis = 0);
+// Set the integer time origin of the next plot in nanoseconds. Timestamps passed to PlotLineTime/PlotScatterTime are plotted as seconds relative to it.
+// If never set, the origin is taken from the first timestamp plotted.
+void SetNextPlotTimeOrigin(ImS64 origin_ns, ImGuiCond cond = ImGuiCond_Once);
 // Fits the next plot axes to all plotted data if they are unlocked (equivalent to double-clicks).
 void FitNextPlotAxes(bool x = true, bool y = true, bool y2 = true, bool y3 = true);
 
@@ -375,16 +670,34 @@ void SetNextPlotTicksX(double x_min, double x_max, int n_ticks, const char** lab
 void SetNextPlotTicksY(const double* values, int n_ticks, const char** labels = NULL, bool show_default = false, int y_axis = 0);
 void SetNextPlotTicksY(double y_min, double y_max, int n_ticks, const char** labels = NULL, bool show_default = false, int y_axis = 0);
 
+// Declares the version of the data passed to the next plot item. The item's data bounds are cached per version, and items whose bounds
+// lie entirely outside of the axes limits are not rendered (they still fit and appear in the legend). Change the version whenever the data changes.
+void SetNextItemDataVersion(int version);
+
+// Declares that the data passed to the next plot item contains no NaN or infinite values. Line and shaded plots then skip the
+// per-point checks that otherwise break lines at missing (NaN) samples. Ignored on log axes, where non-positive values also break lines.
+void SetNextItemDataFinite();
+
+// Returns the number of draw commands #label_id added to the window draw list the last time it was submitted, or -1 if the item doesn't exist.
+// Useful to check how many times large items are split (see ImGuiBackendFlags_RendererHasVtxOffset). Must be called after the item is submitted.
+// With 16-bit ImDrawIdx, a window can only hold 64k vertices unless the backend sets ImGuiBackendFlags_RendererHasVtxOffset; exceeding that asserts.
+int GetItemDrawCmdCount(const char* label_id);
+
 // Select which Y axis will be used for subsequent plot elements. The default is '0', or the first (left) Y axis. Enable 2nd and 3rd axes with ImPlotFlags_YAxisX.
 void SetPlotYAxis(int y_axis);
 
 // Convert pixels to a position in the current plot's coordinate system. A negative y_axis uses the current value of SetPlotYAxis (0 initially).
 ImPlotPoint PixelsToPlot(const ImVec2& pix, int y_axis = -1);
 ImPlotPoint PixelsToPlot(float x, float y, int y_axis = -1);
+// Converts #count pixel positions to the current plot's coordinate system in bulk. The axes scales are resolved once per call.
+void PixelsToPlot(const ImVec2* pix, double* xs, double* ys, int count, int y_axis = -1);
 
 // Convert a position in the current plot's coordinate system to pixels. A negative y_axis uses the current value of SetPlotYAxis (0 initially).
 ImVec2 PlotToPixels(const ImPlotPoint& plt, int y_axis = -1);
 ImVec2 PlotToPixels(double x, double y, int y_axis = -1);
+// Converts #count positions in the current plot's coordinate system to pixels in bulk. The axes scales are resolved once per call,
+// so prefer this over the single point versions for high volumes of points (e.g. custom overlays).
+void PlotToPixels(const double* xs, const double* ys, ImVec2* pix, int count, int y_axis = -1);
 
 //-----------------------------------------------------------------------------
 // Plot Queries
@@ -408,6 +721,8 @@ ImPlotLimits GetPlotLimits(int y_axis = -1);
 bool IsPlotQueried();
 // Returns the current plot query bounds.
 ImPlotLimits GetPlotQuery(int y_axis = -1);
+// Returns the integer time origin of the current plot in nanoseconds (see SetNextPlotTimeOrigin).
+ImS64 GetPlotTimeOrigin();
 // Returns true if a plot item legend entry is hovered.
 bool IsLegendEntryHovered(const char* label_id);
 
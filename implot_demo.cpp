@@ -41,6 +41,7 @@ struct WaveData {
 ImPlotPoint SineWave(void* wave_data, int idx);
 ImPlotPoint SawWave(void* wave_data, int idx);
 ImPlotPoint Spiral(void*, int idx);
+void SquareWaveBatch(void* wave_data, int idx, int count, double* xs, double* ys);
 // Example for Tables section. Generates a quick and simple shaded line plot. See implementation at bottom.
 void Sparkline(const char* id, const float* values, int count, float min_v, float max_v, int offset, const ImVec4& col, const ImVec2& size);
 // Example for Custom Plotters and Tooltips section. Plots a candlestick chart for financial data. See implementation at bottom.
@@ -136,6 +137,7 @@ struct BenchmarkItem {
     ~BenchmarkItem() { delete[] Data; }
     t_float2* Data;
     ImVec4 Col;
+    ImPlotItemHandle Handle;
 };
 
 void ShowDemoWindow(bool* p_open) {
@@ -962,6 +964,7 @@ void ShowDemoWindow(bool* p_open) {
         ImGui::BulletText("Most plotters can be passed a function pointer for getting data.");
         ImGui::BulletText("You can optionally pass user data to be given to your getter.");
         ImGui::BulletText("C++ lambdas can be passed as function pointers as well.");
+        ImGui::BulletText("For large data sets, batch getters fill chunks of points per call (see PlotLineBatch).");
         if (ImPlot::BeginPlot("##Custom Getters")) {
             ImPlot::PlotLine("Spiral", MyImPlot::Spiral, NULL, 1000);
             static MyImPlot::WaveData data1(0.001, 0.2, 2, 0.75);
@@ -971,6 +974,8 @@ void ShowDemoWindow(bool* p_open) {
             ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.25f);
             ImPlot::PlotShaded("Waves", MyImPlot::SineWave, &data1, MyImPlot::SawWave, &data2, 1000);
             ImPlot::PopStyleVar();
+            static MyImPlot::WaveData data3(0.001, 0.1, 3, -0.25);
+            ImPlot::PlotLineBatch("Square", MyImPlot::SquareWaveBatch, &data3, 1000);
             // you can also pass C++ lambdas:
             // auto lamda = [](void* data, int idx) { ... return ImPlotPoint(x,y); };
             // ImPlot::PlotLine("My Lambda", lambda, data, 1000);
@@ -1071,17 +1076,38 @@ void ShowDemoWindow(bool* p_open) {
         ImGui::BulletText("Handle ImGuiBackendFlags_RendererHasVtxOffset for 16-bit indices in your backend.");
         ImGui::BulletText("Enable 32-bit indices in imconfig.h.");
         ImGui::Unindent();
+        static bool use_handles = false;
+        static bool scroll_legend = false;
+        static int draw_cmds = 0;
+        ImGui::Checkbox("Use Item Handles", &use_handles); ImGui::SameLine();
+        ImGui::Checkbox("Scrollable Legend", &scroll_legend);
         ImPlot::SetNextPlotLimits(0,1,0,1,ImGuiCond_Always);
-        if (ImPlot::BeginPlot("##Bench",NULL,NULL,ImVec2(-1,0),ImPlotFlags_Default | ImPlotFlags_NoChild)) {
+        if (ImPlot::BeginPlot("##Bench",NULL,NULL,ImVec2(-1,0),ImPlotFlags_Default | ImPlotFlags_NoChild | (scroll_legend ? ImPlotFlags_LegendScroll : 0))) {
             char buff[16];
             for (int i = 0; i < 100; ++i) {
-                sprintf(buff, "item_%d",i);
                 ImPlot::PushStyleColor(ImPlotCol_Line, items[i].Col);
-                ImPlot::PlotLine(buff, items[i].Data, 1000);
+                if (use_handles) {
+                    // handles only need to be created once, the label is stored by ImPlot
+                    if (items[i].Handle.ID == 0) {
+                        sprintf(buff, "item_%d",i);
+                        items[i].Handle = ImPlot::GetItemHandle(buff);
+                    }
+                    ImPlot::PlotLine(items[i].Handle, items[i].Data, 1000);
+                }
+                else {
+                    sprintf(buff, "item_%d",i);
+                    ImPlot::PlotLine(buff, items[i].Data, 1000);
+                }
                 ImPlot::PopStyleColor();
             }
+            draw_cmds = 0;
+            for (int i = 0; i < n_items; ++i) {
+                sprintf(buff, "item_%d",i);
+                draw_cmds += ImPlot::GetItemDrawCmdCount(buff);
+            }
             ImPlot::EndPlot();
         }
+        ImGui::BulletText("Draw commands added by items: %d", draw_cmds);
     }
     //-------------------------------------------------------------------------
     ImGui::End();
@@ -1103,6 +1129,14 @@ ImPlotPoint SawWave(void* data, int idx) {
     return ImPlotPoint(x, wd->Offset + wd->Amp * (-2 / 3.14 * atan(cos(3.14 * wd->Freq * x) / sin(3.14 * wd->Freq * x))));
 }
 
+void SquareWaveBatch(void* data, int idx, int count, double* xs, double* ys) {
+    WaveData* wd = (WaveData*)data;
+    for (int i = 0; i < count; ++i) {
+        xs[i] = (idx + i) * wd->X;
+        ys[i] = wd->Offset + (sin(2 * 3.14 * wd->Freq * xs[i]) >= 0 ? wd->Amp : -wd->Amp);
+    }
+}
+
 ImPlotPoint Spiral(void*, int idx) {
     float r = 0.9f;            // outer radius
     float a = 0;               // inner radius
@@ -1169,6 +1203,7 @@ void StyleSeaborn() {
     style.ErrorBarWeight   = 1.5f;
     style.DigitalBitHeight = 8;
     style.DigitalBitGap    = 4;
+    style.LineSimplify     = 0;
     style.PlotBorderSize   = 0;
     style.MinorAlpha       = 1.0f;
     style.MajorTickLen     = ImVec2(0,0);
@@ -76,6 +76,10 @@ extern ImPlotContext* GImPlot; // Current implicit context pointer
 #define IMPLOT_SUB_DIV    10
 // Zoom rate for scroll (e.g. 0.1f = 10% plot range every scroll click)
 #define IMPLOT_ZOOM_RATE  0.1f
+// Number of points requested at a time from an ImPlotBatchGetter
+#define IMPLOT_BATCH_SIZE 1024
+// Maximum error in pixels allowed for approximate transforms (single precision, see TransformerLinLinF, and ImFastLog2)
+#define IMPLOT_TRANSFORM_TOLERANCE 0.0625
 
 //-----------------------------------------------------------------------------
 // [SECTION] Generic Helpers
@@ -84,6 +88,27 @@ extern ImPlotContext* GImPlot; // Current implicit context pointer
 // Computes the common (base-10) logarithm
 static inline float  ImLog10(float x)  { return log10f(x); }
 static inline double ImLog10(double x) { return log10(x);  }
+// Computes the base-2 logarithm
+static inline double ImLog2(double x)  { return log(x) * 1.4426950408889634; }
+
+// Upper bound of the absolute error of ImFastLog2
+#define IMPLOT_FAST_LOG2_ERROR 2e-9
+// Approximates the base-2 logarithm of a positive, normal and finite double from its exponent bits and an atanh series
+// on the mantissa reduced to [sqrt(1/2), sqrt(2)). No library call, about twice as fast as log10.
+static inline double ImFastLog2(double x) {
+    ImU64 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int e = (int)((bits >> 52) & 0x7FF) - 1023;
+    bits = (bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull;
+    double m;
+    memcpy(&m, &bits, sizeof(m));
+    if (m > 1.4142135623730951) {
+        m *= 0.5;
+        e += 1;
+    }
+    const double s = (m - 1) / (m + 1), s2 = s * s;
+    return e + s * (2.8853900817779268 + s2 * (0.9617966939259756 + s2 * (0.5770780163555854 + s2 * (0.41219858311113244 + s2 * 0.3205988979753252))));
+}
 
 // Returns true if a flag is set
 template <typename TSet, typename TFlag>
@@ -99,6 +124,7 @@ inline T ImRemap(T x, T x0, T x1, T y0, T y1) { return y0 + (x - x0) * (y1 - y0)
 
 // Returns always positive modulo (assumes r != 0)
 inline int ImPosMod(int l, int r) { return (l % r + r) % r; }
+inline ImS64 ImPosMod(ImS64 l, ImS64 r) { return (l % r + r) % r; }
 
 // Offset calculator helper
 template <int Count>
@@ -248,15 +274,31 @@ struct ImPlotItem
     bool    Show;
     bool    Highlight;
     bool    SeenThisFrame;
+    bool    Recolor;
     int     NameOffset;
+    float   NameWidth;
+    int     DataVersion;
+    ImPlotLimits DataBounds;
+    ImVector<ImPlotPoint> ProviderPoints;  // last completed result of an ImPlotDataProvider
+    ImPlotRange           ProviderRange;   // X range the cached result was requested for
+    int                   ProviderWidth;   // plot width in pixels the cached result was requested for
+    int                   ProviderVersion; // data version the cached result was requested for
+    bool                  ProviderValid;
+    int                   DrawCmdCount;    // draw commands added by the item the last time it was submitted (see GetItemDrawCmdCount)
 
     ImPlotItem() {
         ID            = 0;
         Color         = ImPlot::NextColormapColor();
         Show          = true;
         SeenThisFrame = false;
+        Recolor       = false;
         Highlight     = false;
         NameOffset    = -1;
+        NameWidth     = -1;
+        DataVersion   = -1;
+        ProviderWidth = ProviderVersion = -1;
+        ProviderValid = false;
+        DrawCmdCount  = 0;
     }
 
     ~ImPlotItem() { ID = 0; }
@@ -270,6 +312,18 @@ struct ImPlotState
     ImPlotAxis         XAxis;
     ImPlotAxis         YAxis[IMPLOT_Y_AXES];
     ImPool<ImPlotItem> Items;
+    ImVector<int>      LegendIndices;
+    ImGuiTextBuffer    LegendLabels;
+    int                LegendLabelsUnused;
+    ImVector<int>      LegendEntries;
+    char               LegendFilter[64];
+    float              LegendWidth;
+    float              LegendFontSize;
+    float              LegendScroll;
+    float              LegendScrollMax;
+    int                LegendHighlight;
+    bool               LegendFiltered;
+    bool               LegendDirty;
     ImVec2             SelectStart;
     ImVec2             QueryStart;
     ImRect             QueryRect;
@@ -280,12 +334,22 @@ struct ImPlotState
     bool               DraggingQuery;
     int                ColormapIdx;
     int                CurrentYAxis;
+    ImS64              TimeOrigin;
+    bool               HasTimeOrigin;
 
     ImPlotState() {
         Flags        = PreviousFlags = ImPlotFlags_Default;
         SelectStart  = QueryStart = ImVec2(0,0);
         Selecting    = Querying = Queried = DraggingQuery = false;
         ColormapIdx  = CurrentYAxis = 0;
+        LegendLabelsUnused = 0;
+        LegendFilter[0]    = 0;
+        LegendWidth        = LegendFontSize = LegendScroll = LegendScrollMax = 0;
+        LegendHighlight    = -1;
+        LegendFiltered     = false;
+        LegendDirty        = true;
+        TimeOrigin         = 0;
+        HasTimeOrigin      = false;
     }
 };
 
@@ -302,9 +366,13 @@ struct ImPlotNextPlotData
     bool        ShowDefaultTicksY[IMPLOT_Y_AXES];
     bool        FitX;
     bool        FitY[IMPLOT_Y_AXES];
+    ImS64       TimeOrigin;
+    ImGuiCond   TimeOriginCond;
+    bool        HasTimeOrigin;
 
     ImPlotNextPlotData() {
         HasXRange         = false;
+        HasTimeOrigin     = false;
         ShowDefaultTicksX = true;
         FitX              = false;
         for (int i = 0; i < IMPLOT_Y_AXES; ++i) {
@@ -322,8 +390,7 @@ struct ImPlotContext {
     ImPlotState*        CurrentPlot;
 
     // Legend
-    ImVector<int>   LegendIndices;
-    ImGuiTextBuffer LegendLabels;
+    int LegendCount;
 
     // Bounding Boxes
     ImRect BB_Frame;
@@ -349,6 +416,16 @@ struct ImPlotContext {
     double      My[IMPLOT_Y_AXES];
     double      LogDenX;
     double      LogDenY[IMPLOT_Y_AXES];
+    float       FltOriginX, FltPixX, FltMx;     // single precision transform, rebased on the X axis minimum
+    float       FltOriginY[IMPLOT_Y_AXES];      // single precision transforms, rebased on the Y axes minimums
+    float       FltPixY[IMPLOT_Y_AXES];
+    float       FltMy[IMPLOT_Y_AXES];
+    bool        FltSafe[IMPLOT_Y_AXES];         // single precision transforms are within IMPLOT_TRANSFORM_TOLERANCE for X and this Y axis
+    double      Log2MinX, LogMx;                // log scale X axis: log2 of the minimum and pixels per unit of log2(x)
+    double      Log2MinY[IMPLOT_Y_AXES];        // log scale Y axes: log2 of the minimums
+    double      LogMy[IMPLOT_Y_AXES];           // log scale Y axes: pixels per unit of log2(y)
+    bool        FastLogX;                       // ImFastLog2 is within IMPLOT_TRANSFORM_TOLERANCE for the X axis
+    bool        FastLogY[IMPLOT_Y_AXES];        // ImFastLog2 is within IMPLOT_TRANSFORM_TOLERANCE for this Y axis
     ImPlotRange ExtentsX;
     ImPlotRange ExtentsY[IMPLOT_Y_AXES];
 
@@ -357,6 +434,25 @@ struct ImPlotContext {
     bool FitX;
     bool FitY[IMPLOT_Y_AXES];
 
+    // Item Data Bounds
+    int          NextItemDataVersion;
+    int          ItemDataVersion;
+    bool         NextItemDataFinite;
+    bool         ItemDataFinite;
+    ImPlotLimits ItemBounds;
+    int          ItemCmdIndex; // index of the item whose draw commands are being counted, or -1
+    int          ItemCmdStart; // draw list command count when that item was submitted
+    ImVector<ImPlotPoint> ProviderBuffer;
+    ImVector<ImPlotPoint> DecodeBuffer;
+    ImVector<double>      HistoryXs;     // scratch for plotting an ImPlotHistoryBuffer (see implot_streaming.h)
+    ImVector<double>      HistoryMins;
+    ImVector<double>      HistoryMaxs;
+    ImVector<ImPlotPoint> HistoryPoints;
+    ImVector<double>      BatchXs;    // last chunk returned by an ImPlotBatchGetter
+    ImVector<double>      BatchYs;
+    int                   BatchStart; // index of the first point of the chunk
+    int                   BatchCount; // number of points in the chunk
+
     // Hover states
     bool Hov_Frame;
     bool Hov_Plot;
@@ -420,22 +516,28 @@ void BustPlotCache();
 void UpdateTransformCache();
 // Extends the current plots axes so that it encompasses point p
 void FitPoint(const ImPlotPoint& p);
+// Returns true if any part of bounds is within the current plot's axes limits (x only if y is false)
+bool IsInView(const ImPlotLimits& bounds, bool y = true);
 
 // Register or get an existing item from the current plot
 ImPlotItem* RegisterOrGetItem(const char* label_id);
+// Register or get an existing item from the current plot by a handle obtained from GetItemHandle
+ImPlotItem* RegisterOrGetItem(const ImPlotItemHandle& handle);
 // Get the ith plot item from the current plot
 ImPlotItem* GetItem(int i);
 // Get a plot item from the current plot
 ImPlotItem* GetItem(const char* label_id);
 // Gets a plot item from a specific plot
 ImPlotItem* GetItem(const char* plot_title, const char* item_label_id);
-// Busts the cache for every item for every plot in the current context.
+// Busts the cache for every item for every plot in the current context. Items are recolored the next time they are plotted.
 void BustItemCache();
 
 // Returns the number of entries in the current legend
 int GetLegendCount();
 // Gets the ith entry string for the current legend
 const char* GetLegendLabel(int i);
+// Rebuilds the current plot's cached legend entries and label width if the legend changed since the last call
+void UpdateLegendEntries(bool filter);
 
 // Populates a list of ImPlotTicks with normal spaced and formatted ticks
 void AddTicksDefault(const ImPlotRange& range, int nMajor, int nMinor, ImVector<ImPlotTick> &out);
@@ -443,8 +545,12 @@ void AddTicksDefault(const ImPlotRange& range, int nMajor, int nMinor, ImVector<
 void AddTicksLogarithmic(const ImPlotRange& range, int nMajor, ImVector<ImPlotTick>& out);
 // Populates a list of ImPlotTicks with custom spaced and labeled ticks
 void AddTicksCustom(const double* values, const char** labels, int n, ImVector<ImPlotTick>& ticks, ImGuiTextBuffer& buffer);
+// Populates a list of ImPlotTicks with ticks spaced in time units (1-2-5 steps below a minute, calendar-like steps above)
+void AddTicksTime(const ImPlotRange& range, int nMajor, ImVector<ImPlotTick>& out);
 // Creates label information for a list of ImPlotTick
 void LabelTicks(ImVector<ImPlotTick> &ticks, bool scientific, ImGuiTextBuffer& buffer);
+// Creates label information for a list of ImPlotTick spaced in seconds, using the time unit that best fits their spacing
+void LabelTicksTime(ImVector<ImPlotTick> &ticks, ImGuiTextBuffer& buffer);
 // Gets the widest visible (i.e. ShowLabel = true) label size from a list of ticks
 float MaxTickLabelWidth(const ImVector<ImPlotTick>& ticks);
 // Sums the widths of visible ticks (i.e. ShowLabel = true) ticks
@@ -454,6 +560,8 @@ float SumTickLabelHeight(const ImVector<ImPlotTick>& ticks);
 
 // Rounds x to powers of 2,5 and 10 for generating axis labels (from Graphics Gems 1 Chapter 11.2)
 double NiceNum(double x, bool round);
+// Returns the largest time unit (ns, us, ms, s, min, h, d) not larger than a step in seconds, and its scale factor from seconds
+const char* TimeUnit(double step, double* scale);
 // Updates axis ticks, lins, and label colors
 void UpdateAxisColors(int axis_flag, ImPlotAxisColor* col);
 // Draws vertical text. The position is the bottom left of the text rect.
@@ -469,6 +577,12 @@ inline bool NanOrInf(double val) { return val == HUGE_VAL || val == -HUGE_VAL ||
 inline double ConstrainNan(double val) { return isnan(val) ? 0 : val; }
 // Turns infinity to floating point maximums
 inline double ConstrainInf(double val) { return val == HUGE_VAL ?  DBL_MAX : val == -HUGE_VAL ? - DBL_MAX : val; }
+// Returns log2(val) for log scale transforms, approximated if #fast. Non-positive values give NAN, i.e. a gap, without calling log.
+inline double TransformLog2(double val, bool fast) {
+    if (fast && val >= DBL_MIN && val <= DBL_MAX)
+        return ImFastLog2(val);
+    return val > 0 ? ImLog2(val) : NAN;
+}
 // Turns numbers less than or equal to 0 to 0.001 (sort of arbitrary, is there a better way?)
 inline double ConstrainLog(double val) { return val <= 0 ? 0.001f : val; }
 
@@ -497,10 +611,21 @@ void FillRange(ImVector<T>& buffer, int n, T vmin, T vmax) {
     }
 }
 
-// Offsets and strides a data buffer
-template <typename T>
-inline T OffsetAndStride(const T* data, int idx, int count, int offset, int stride) {
-    idx = ImPosMod(offset + idx, count);
+// Offsets an index into a ring buffer of count elements that starts at offset. The buffer is walked as two contiguous
+// spans, [offset,count) then [0,offset), so no modulo is needed. Requires 0 <= offset < count and 0 <= idx < count.
+inline int OffsetIndex(int idx, int count, int offset) {
+    const int split = count - offset;
+    return idx < split ? idx + offset : idx - split;
+}
+inline ImS64 OffsetIndex(ImS64 idx, ImS64 count, ImS64 offset) {
+    const ImS64 split = count - offset;
+    return idx < split ? idx + offset : idx - split;
+}
+
+// Offsets and strides a data buffer (see OffsetIndex for requirements)
+template <typename T, typename I>
+inline T OffsetAndStride(const T* data, I idx, I count, I offset, int stride) {
+    idx = OffsetIndex(idx, count, offset);
     return *(const T*)(const void*)((const unsigned char*)data + (size_t)idx * stride);
 }
 
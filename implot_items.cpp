@@ -24,24 +24,12 @@
 
 #include "implot.h"
 #include "implot_internal.h"
+#include "implot_templates.h"
 
 #ifdef _MSC_VER
 #define sprintf sprintf_s
 #endif
 
-#define SQRT_1_2 0.70710678118f
-#define SQRT_3_2 0.86602540378f
-
-#define IM_NORMALIZE2F_OVER_ZERO(VX, VY)                                                           \
-    {                                                                                              \
-        float d2 = VX * VX + VY * VY;                                                              \
-        if (d2 > 0.0f) {                                                                           \
-            float inv_len = 1.0f / ImSqrt(d2);                                                     \
-            VX *= inv_len;                                                                         \
-            VY *= inv_len;                                                                         \
-        }                                                                                          \
-    }
-
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -88,6 +76,369 @@ struct GetterXsYs {
     }
 };
 
+// Interprets an array of Y points as ImPlotPoints where the X value is the index (64-bit sample count and offset).
+// Visits the window of samples [Base, Base + Count), which covers up to the first INT_MAX samples unless moved.
+template <typename T>
+struct GetterYs64 {
+    GetterYs64(const T* ys, ImS64 count, ImS64 offset, int stride) {
+        Ys = ys;
+        Size = count;
+        Offset = count ? ImPosMod(offset, count) : 0;
+        Stride = stride;
+        Base = 0;
+        Count = (int)ImMin(count, (ImS64)INT_MAX);
+    }
+    const T* Ys;
+    ImS64 Size;
+    ImS64 Offset;
+    ImS64 Base;
+    int Count;
+    int Stride;
+    inline double Y(ImS64 i) const {
+        return (double)OffsetAndStride(Ys, i, Size, Offset, Stride);
+    }
+    inline ImPlotPoint Point(ImS64 i) const {
+        return ImPlotPoint((double)i, Y(i));
+    }
+    inline ImPlotPoint operator()(int idx) {
+        return Point(Base + idx);
+    }
+};
+
+// Interprets separate arrays for X and Y points as ImPlotPoints (64-bit sample count and offset, see GetterYs64)
+template <typename T>
+struct GetterXsYs64 {
+    GetterXsYs64(const T* xs, const T* ys, ImS64 count, ImS64 offset, int stride) {
+        Xs = xs; Ys = ys;
+        Size = count;
+        Offset = count ? ImPosMod(offset, count) : 0;
+        Stride = stride;
+        Base = 0;
+        Count = (int)ImMin(count, (ImS64)INT_MAX);
+    }
+    const T* Xs;
+    const T* Ys;
+    ImS64 Size;
+    ImS64 Offset;
+    ImS64 Base;
+    int Count;
+    int Stride;
+    inline double Y(ImS64 i) const {
+        return (double)OffsetAndStride(Ys, i, Size, Offset, Stride);
+    }
+    inline ImPlotPoint Point(ImS64 i) const {
+        return ImPlotPoint((double)OffsetAndStride(Xs, i, Size, Offset, Stride), Y(i));
+    }
+    inline ImPlotPoint operator()(int idx) {
+        return Point(Base + idx);
+    }
+};
+
+// Finds the indices of the min and max Y samples of bucket #bucket (of #step samples each) of a 64-bit getter, ordered by index.
+template <typename Getter>
+inline void ReduceBucket(const Getter& getter, ImS64 bucket, ImS64 step, ImS64* first, ImS64* second) {
+    const ImS64 i0 = bucket * step;
+    const ImS64 i1 = ImMin(i0 + step, getter.Size);
+    ImS64 i_min = i0, i_max = i0;
+    double y_min = getter.Y(i0), y_max = y_min;
+    for (ImS64 i = i0 + 1; i < i1; ++i) {
+        const double y = getter.Y(i);
+        if (y < y_min)      { y_min = y; i_min = i; }
+        else if (y > y_max) { y_max = y; i_max = i; }
+    }
+    *first  = ImMin(i_min, i_max);
+    *second = ImMax(i_min, i_max);
+}
+
+// Reduces a 64-bit getter holding more than INT_MAX samples for line rendering. The samples are split into at most INT_MAX / 2
+// buckets of Step samples and each bucket is visited as its min and max Y samples in sample order, so spikes are not aliased away.
+// Only meant for lines: points that are not a Y extreme of their bucket are skipped, which scatter plots can't afford.
+template <typename Getter>
+struct GetterMinMax64 {
+    GetterMinMax64(const Getter& src) : Src(src) {
+        const ImS64 max_buckets = INT_MAX / 2;
+        Step = (src.Size + max_buckets - 1) / max_buckets;
+        Count = (int)(2 * ((src.Size + Step - 1) / Step));
+        Bucket = -1;
+    }
+    Getter Src;
+    ImS64 Step;
+    int Count;
+    ImS64 Bucket, First, Second; // last reduced bucket
+    inline ImPlotPoint operator()(int idx) {
+        if (Bucket != idx / 2) {
+            Bucket = idx / 2;
+            ReduceBucket(Src, Bucket, Step, &First, &Second);
+        }
+        return Src.Point((idx & 1) ? Second : First);
+    }
+};
+
+// Interprets a window of #count points starting at #start of X and Y ring buffers holding #capacity points as ImPlotPoints.
+// The window is walked as two contiguous spans, so no modulo is needed. Requires 0 <= start < capacity and count <= capacity.
+template <typename T>
+struct GetterXsYsRing {
+    GetterXsYsRing(const T* xs, const T* ys, int capacity, int start, int count, int stride) {
+        Xs = xs; Ys = ys;
+        Capacity = capacity;
+        Start = start;
+        Count = count;
+        Stride = stride;
+    }
+    const T* Xs;
+    const T* Ys;
+    int Capacity;
+    int Start;
+    int Count;
+    int Stride;
+    inline ImPlotPoint operator()(int idx) {
+        idx += Start;
+        if (idx >= Capacity)
+            idx -= Capacity;
+        return ImPlotPoint(OffsetAndStride(Xs, idx, Capacity, 0, Stride), OffsetAndStride(Ys, idx, Capacity, 0, Stride));
+    }
+};
+
+// Interprets an array of Y values of any numeric type as ImPlotPoints where the X value is the index and Y is scaled and biased
+template <typename T>
+struct GetterYsScaled {
+    GetterYsScaled(const T* ys, int count, int offset, int stride, double scale, double bias) {
+        Ys = ys;
+        Count = count;
+        Offset = count ? ImPosMod(offset, count) : 0;
+        Stride = stride;
+        Scale = scale;
+        Bias = bias;
+    }
+    const T* Ys;
+    int Count;
+    int Offset;
+    int Stride;
+    double Scale;
+    double Bias;
+    inline ImPlotPoint operator()(int idx) {
+        return ImPlotPoint((double)idx, (double)OffsetAndStride(Ys, idx, Count, Offset, Stride) * Scale + Bias);
+    }
+};
+
+// Interprets separate arrays of any numeric type for X and Y points as ImPlotPoints where Y is scaled and biased
+template <typename T>
+struct GetterXsYsScaled {
+    GetterXsYsScaled(const T* xs, const T* ys, int count, int offset, int stride, double scale, double bias) {
+        Xs = xs; Ys = ys;
+        Count = count;
+        Offset = count ? ImPosMod(offset, count) : 0;
+        Stride = stride;
+        Scale = scale;
+        Bias = bias;
+    }
+    const T* Xs;
+    const T* Ys;
+    int Count;
+    int Offset;
+    int Stride;
+    double Scale;
+    double Bias;
+    inline ImPlotPoint operator()(int idx) {
+        return ImPlotPoint((double)OffsetAndStride(Xs, idx, Count, Offset, Stride), (double)OffsetAndStride(Ys, idx, Count, Offset, Stride) * Scale + Bias);
+    }
+};
+
+// Interprets an array of int64 nanosecond timestamps and an array of Y values as ImPlotPoints. The time origin is
+// subtracted in integer space before X is converted to seconds, preserving nanosecond resolution near the origin.
+template <typename TS, typename T>
+struct GetterTimeYs {
+    GetterTimeYs(const TS* ts, const T* ys, int count, int offset, int ts_stride, int y_stride, ImS64 origin) {
+        Ts = ts; Ys = ys;
+        Count = count;
+        Offset = count ? ImPosMod(offset, count) : 0;
+        TsStride = ts_stride;
+        YStride = y_stride;
+        Origin = origin;
+    }
+    const TS* Ts;
+    const T* Ys;
+    int Count;
+    int Offset;
+    int TsStride;
+    int YStride;
+    ImS64 Origin;
+    inline ImPlotPoint operator()(int idx) {
+        const ImS64 t = (ImS64)OffsetAndStride(Ts, idx, Count, Offset, TsStride) - Origin;
+        return ImPlotPoint((double)t * 1e-9, (double)OffsetAndStride(Ys, idx, Count, Offset, YStride));
+    }
+};
+
+// Returns the current plot's time origin, taking it from the first timestamp if the plot does not have one yet
+template <typename TS>
+inline ImS64 GetTimeOrigin(const TS* ts, int count, int offset, int stride) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotLineTime() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlotState& plot = *gp.CurrentPlot;
+    if (!plot.HasTimeOrigin && count > 0) {
+        plot.TimeOrigin    = (ImS64)OffsetAndStride(ts, 0, count, ImPosMod(offset, count), stride);
+        plot.HasTimeOrigin = true;
+    }
+    return plot.TimeOrigin;
+}
+
+// Interprets an array of Y values as ImPlotPoints where X is implicit and uniformly spaced (x = x0 + idx * dx).
+// Only the samples [First, First + Count) are visited, see ClipGetterToView.
+template <typename T>
+struct GetterYsUniform {
+    GetterYsUniform(const T* ys, int count, double x0, double dx, int offset, int stride) {
+        Ys = ys;
+        Size = Count = count;
+        First = 0;
+        X0 = x0;
+        Dx = dx;
+        Offset = count ? ImPosMod(offset, count) : 0;
+        Stride = stride;
+    }
+    const T* Ys;
+    int Size;
+    int Count;
+    int First;
+    double X0;
+    double Dx;
+    int Offset;
+    int Stride;
+    inline ImPlotPoint operator()(int idx) {
+        idx += First;
+        return ImPlotPoint(X0 + idx * Dx, (double)OffsetAndStride(Ys, idx, Size, Offset, Stride));
+    }
+};
+
+// Always returns a constant Y reference value where X is implicit and uniformly spaced (x = x0 + idx * dx)
+struct GetterYRefUniform {
+    GetterYRefUniform(double y_ref, int count, double x0, double dx) {
+        YRef = y_ref;
+        Size = Count = count;
+        First = 0;
+        X0 = x0;
+        Dx = dx;
+    }
+    inline ImPlotPoint operator()(int idx) {
+        return ImPlotPoint(X0 + (idx + First) * Dx, YRef);
+    }
+    double YRef;
+    int Size;
+    int Count;
+    int First;
+    double X0;
+    double Dx;
+};
+
+// Reads a single scalar of type T at any byte address (e.g. a field of a packed record) and converts it to double
+template <typename T>
+inline double ReadScalar(const unsigned char* ptr) {
+    T value;
+    memcpy(&value, ptr, sizeof(T));
+    return (double)value;
+}
+
+// Interprets separate X and Y columns of independent types and byte strides as ImPlotPoints (e.g. fields of interleaved records)
+template <typename TX, typename TY>
+struct GetterXsYsScalar {
+    GetterXsYsScalar(const void* xs, int x_stride, const void* ys, int y_stride, int count, int offset) {
+        Xs = (const unsigned char*)xs; XStride = x_stride;
+        Ys = (const unsigned char*)ys; YStride = y_stride;
+        Count = count;
+        Offset = count ? ImPosMod(offset, count) : 0;
+    }
+    const unsigned char* Xs;
+    int XStride;
+    const unsigned char* Ys;
+    int YStride;
+    int Count;
+    int Offset;
+    inline ImPlotPoint operator()(int idx) {
+        idx = OffsetIndex(idx, Count, Offset);
+        return ImPlotPoint(ReadScalar<TX>(Xs + (size_t)idx * XStride), ReadScalar<TY>(Ys + (size_t)idx * YStride));
+    }
+};
+
+// Reads uniformly spaced samples (x = x0 + idx * dx) of type T from a memory mapped file. Only every Step-th sample
+// in [First, First + Count * Step) is visited, so at most about two samples per pixel are read and only their pages are faulted in.
+// Samples are picked by stride rather than min/max so that skipped pages are never touched (min/max would read the whole range).
+template <typename T>
+struct GetterMapped {
+    GetterMapped(const unsigned char* data, int stride, ImS64 size, double x0, double dx) {
+        Data = data;
+        Stride = stride;
+        Size = size;
+        X0 = x0;
+        Dx = dx;
+        Decimate(0, size);
+    }
+    inline void Decimate(ImS64 first, ImS64 count) {
+        const ImS64 budget = ImMax((ImS64)2, (ImS64)(2 * GImPlot->BB_Plot.GetWidth()));
+        First = first;
+        Step  = count > budget ? (count + budget - 1) / budget : 1;
+        Count = (int)((count + Step - 1) / Step);
+    }
+    inline ImPlotPoint operator()(int idx) {
+        const ImS64 i = First + (ImS64)idx * Step;
+        return ImPlotPoint(X0 + (double)i * Dx, ReadScalar<T>(Data + (size_t)i * Stride));
+    }
+    const unsigned char* Data;
+    int Stride;
+    ImS64 Size;
+    ImS64 First;
+    ImS64 Step;
+    int Count;
+    double X0;
+    double Dx;
+};
+
+// Reads a compressed series. Until ClipGetterToView decodes the blocks in view, the points are the block summaries
+// (first X with min Y, last X with max Y), which bound the data and let the item be fit without decoding anything.
+struct GetterCompressed {
+    GetterCompressed(const ImPlotCompressedSeries* series) {
+        Series = series;
+        Points = NULL;
+        Count  = series->Blocks.Size * 2;
+    }
+    inline ImPlotPoint operator()(int idx) {
+        if (Points != NULL)
+            return Points[idx];
+        const ImPlotCompressedBlock& block = Series->Blocks[idx >> 1];
+        return (idx & 1) ? ImPlotPoint(Series->GetX(block.XMax), block.YMax) : ImPlotPoint(Series->GetX(block.XMin), block.YMin);
+    }
+    const ImPlotCompressedSeries* Series;
+    const ImPlotPoint* Points;
+    int Count;
+};
+
+// Reads a quantized series, dequantizing samples as they are visited (x = x0 + idx * dx).
+// Only the samples [First, First + Count) are visited, see ClipGetterToView.
+struct GetterQuantized {
+    GetterQuantized(const ImPlotQuantizedSeries* series) {
+        Series = series;
+        Size = Count = series->GetCount();
+        First = 0;
+    }
+    inline ImPlotPoint operator()(int idx) {
+        idx += First;
+        const ImPlotQuantizedSeries& s = *Series;
+        const double x = s.X0 + idx * s.Dx;
+        const int b = idx / s.BlockSize;
+        const int i = idx - b * s.BlockSize;
+        if (b == s.Blocks.Size)
+            return ImPlotPoint(x, s.Pending[i]);
+        const ImPlotQuantizedBlock& block = s.Blocks[b];
+        const ImU8* q = s.Bytes.Data + block.ByteOffset;
+        if (block.Width == 1)
+            return ImPlotPoint(x, q[i] == 0xFF ? NAN : block.Offset + q[i] * block.Scale);
+        const int q16 = q[2 * i] | (q[2 * i + 1] << 8);
+        return ImPlotPoint(x, q16 == 0xFFFF ? NAN : block.Offset + q16 * block.Scale);
+    }
+    const ImPlotQuantizedSeries* Series;
+    int Size;
+    int Count;
+    int First;
+};
+
 // Always returns a constant Y reference value where the X value is the index
 template <typename T>
 struct GetterYRef {
@@ -127,7 +478,7 @@ struct GetterImVec2 {
         Offset = count ? ImPosMod(offset, count) : 0;
     }
     inline ImPlotPoint operator()(int idx) {
-        idx = ImPosMod(Offset + idx, Count);
+        idx = OffsetIndex(idx, Count, Offset);
         return ImPlotPoint(Data[idx].x, Data[idx].y);
     }
     const ImVec2* Data;
@@ -143,7 +494,7 @@ struct GetterImPlotPoint {
         Offset = count ? ImPosMod(offset, count) : 0;
     }
     inline ImPlotPoint operator()(int idx) {
-        idx = ImPosMod(Offset + idx, Count);
+        idx = OffsetIndex(idx, Count, Offset);
         return Data[idx];
     }
     const ImPlotPoint* Data;
@@ -160,7 +511,7 @@ struct GetterFuncPtrImPlotPoint {
         Offset = count ? ImPosMod(offset, count) : 0;
     }
     inline ImPlotPoint operator()(int idx) {
-        idx = ImPosMod(Offset + idx, Count);
+        idx = OffsetIndex(idx, Count, Offset);
         return getter(Data, idx);
     }
     ImPlotPoint (*getter)(void* data, int idx);
@@ -169,17 +520,46 @@ struct GetterFuncPtrImPlotPoint {
     int Offset;
 };
 
+// Interprets a batch getter callback as ImPlotPoints. Points are fetched IMPLOT_BATCH_SIZE at a time into a chunk cache in the
+// context, which is shared by all copies of the getter, so sequential access costs one callback per chunk instead of one per point.
+struct GetterBatch {
+    GetterBatch(ImPlotBatchGetter g, void* d, int count, int offset) {
+        ImPlotContext& gp = *GImPlot;
+        getter = g;
+        Data = d;
+        Count = count;
+        Offset = count ? ImPosMod(offset, count) : 0;
+        gp.BatchXs.resize(IMPLOT_BATCH_SIZE);
+        gp.BatchYs.resize(IMPLOT_BATCH_SIZE);
+        gp.BatchStart = gp.BatchCount = 0;
+    }
+    inline ImPlotPoint operator()(int idx) {
+        ImPlotContext& gp = *GImPlot;
+        idx = OffsetIndex(idx, Count, Offset);
+        if (idx < gp.BatchStart || idx >= gp.BatchStart + gp.BatchCount) {
+            gp.BatchStart = idx;
+            gp.BatchCount = ImMin(IMPLOT_BATCH_SIZE, Count - idx);
+            getter(Data, gp.BatchStart, gp.BatchCount, gp.BatchXs.Data, gp.BatchYs.Data);
+        }
+        return ImPlotPoint(gp.BatchXs.Data[idx - gp.BatchStart], gp.BatchYs.Data[idx - gp.BatchStart]);
+    }
+    ImPlotBatchGetter getter;
+    void* Data;
+    int Count;
+    int Offset;
+};
+
 template <typename T>
 struct GetterBarV {
     const T* Ys; T XShift; int Count; int Offset; int Stride;
-    GetterBarV(const T* ys, T xshift, int count, int offset, int stride) { Ys = ys; XShift = xshift; Count = count; Offset = offset; Stride = stride; }
+    GetterBarV(const T* ys, T xshift, int count, int offset, int stride) { Ys = ys; XShift = xshift; Count = count; Offset = count ? ImPosMod(offset, count) : 0; Stride = stride; }
     inline ImPlotPoint operator()(int idx) { return ImPlotPoint((T)idx + XShift, OffsetAndStride(Ys, idx, Count, Offset, Stride)); }
 };
 
 template <typename T>
 struct GetterBarH {
     const T* Xs; T YShift; int Count; int Offset; int Stride;
-    GetterBarH(const T* xs, T yshift, int count, int offset, int stride) { Xs = xs; YShift = yshift; Count = count; Offset = offset; Stride = stride; }
+    GetterBarH(const T* xs, T yshift, int count, int offset, int stride) { Xs = xs; YShift = yshift; Count = count; Offset = count ? ImPosMod(offset, count) : 0; Stride = stride; }
     inline ImPlotPoint operator()(int idx) { return ImPlotPoint(OffsetAndStride(Xs, idx, Count, Offset, Stride), (T)idx + YShift); }
 };
 
@@ -187,7 +567,7 @@ template <typename T>
 struct GetterError {
     const T* Xs; const T* Ys; const T* Neg; const T* Pos; int Count; int Offset; int Stride;
     GetterError(const T* xs, const T* ys, const T* neg, const T* pos, int count, int offset, int stride) {
-        Xs = xs; Ys = ys; Neg = neg; Pos = pos; Count = count; Offset = offset; Stride = stride;
+        Xs = xs; Ys = ys; Neg = neg; Pos = pos; Count = count; Offset = count ? ImPosMod(offset, count) : 0; Stride = stride;
     }
     ImPlotPointError operator()(int idx) {
         return ImPlotPointError(OffsetAndStride(Xs,  idx, Count, Offset, Stride),
@@ -197,579 +577,608 @@ struct GetterError {
     }
 };
 
+// Getters over float data, which are transformed in single precision when the axes ranges allow it (see TransformerLinLinF)
+template <> struct IsFloatGetter<GetterYs<float> >          { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterXsYs<float> >        { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterYs64<float> >        { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterXsYs64<float> >      { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterXsYsRing<float> >    { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterYsUniform<float> >   { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterYRef<float> >        { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterYRefUniform>         { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterXsYRef<float> >      { static const bool Value = true; };
+template <> struct IsFloatGetter<GetterImVec2>              { static const bool Value = true; };
+
 //-----------------------------------------------------------------------------
-// TRANSFORMERS
+// ITEM CULLING
 //-----------------------------------------------------------------------------
 
-// Transforms convert points in plot space (i.e. ImPlotPoint) to pixel space (i.e. ImVec2)
-
-// Transforms points for linear x and linear y space
-struct TransformerLinLin {
-    TransformerLinLin(int y_axis) : YAxis(y_axis) {}
+template <typename T>
+inline void ClipGetterToView(GetterYsUniform<T>& getter) {
+    ClipUniformRange(getter.X0, getter.Dx, getter.Size, &getter.First, &getter.Count);
+}
 
-    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
-    inline ImVec2 operator()(double x, double y) {
-        ImPlotContext& gp = *GImPlot;
-        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min)),
-                       (float)(gp.PixelRange[YAxis].Min.y + gp.My[YAxis] * (y - gp.CurrentPlot->YAxis[YAxis].Range.Min)) );
-    }
+inline void ClipGetterToView(GetterYRefUniform& getter) {
+    ClipUniformRange(getter.X0, getter.Dx, getter.Size, &getter.First, &getter.Count);
+}
 
-    int YAxis;
-};
+template <typename T>
+inline void ClipGetterToView(GetterMapped<T>& getter) {
+    ImS64 first = 0, count = getter.Size;
+    ClipUniformRange(getter.X0, getter.Dx, getter.Size, &first, &count);
+    getter.Decimate(first, count);
+}
 
-// Transforms points for log x and linear y space
-struct TransformerLogLin {
-    TransformerLogLin(int y_axis) : YAxis(y_axis) {}
+inline void ClipGetterToView(GetterQuantized& getter) {
+    ClipUniformRange(getter.Series->X0, getter.Series->Dx, getter.Size, &getter.First, &getter.Count);
+}
 
-    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
-    inline ImVec2 operator()(double x, double y) {
-        ImPlotContext& gp = *GImPlot;
-        double t = ImLog10(x / gp.CurrentPlot->XAxis.Range.Min) / gp.LogDenX;
-        x        = ImLerp(gp.CurrentPlot->XAxis.Range.Min, gp.CurrentPlot->XAxis.Range.Max, (float)t);
-        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min)),
-                       (float)(gp.PixelRange[YAxis].Min.y + gp.My[YAxis] * (y - gp.CurrentPlot->YAxis[YAxis].Range.Min)) );
+// Decodes the blocks of a compressed series that overlap the current X axis range (plus one on either side so that lines
+// extend to the plot edges). Blocks narrower than a pixel are emitted as a vertical min/max segment from their summary.
+inline void ClipGetterToView(GetterCompressed& getter) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotCompressedSeries& series = *getter.Series;
+    const ImVector<ImPlotCompressedBlock>& blocks = series.Blocks;
+    const ImPlotRange& range = gp.CurrentPlot->XAxis.Range;
+    const double px = range.Size() / ImMax(1.0f, gp.BB_Plot.GetWidth());
+    // blocks are sorted by X, so binary search for the first block ending in view and the first block starting after it
+    int lo = 0, hi = blocks.Size;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (series.GetX(blocks[mid].XMax) < range.Min) lo = mid + 1;
+        else                                           hi = mid;
+    }
+    const int b0 = ImMax(lo - 1, 0);
+    hi = blocks.Size;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (series.GetX(blocks[mid].XMin) <= range.Max) lo = mid + 1;
+        else                                            hi = mid;
     }
+    const int b1 = ImMin(lo + 1, blocks.Size);
+    ImVector<ImPlotPoint>& points = gp.DecodeBuffer;
+    points.resize(0);
+    for (int b = b0; b < b1; ++b) {
+        const ImPlotCompressedBlock& block = blocks[b];
+        if (block.Count > 2 && (series.GetX(block.XMax) - series.GetX(block.XMin)) < px) {
+            if (block.YMin > block.YMax) // only NaNs
+                continue;
+            const double x = series.GetX(block.XMin + (block.XMax - block.XMin) / 2);
+            points.push_back(ImPlotPoint(x, block.YMin));
+            if (block.YMax != block.YMin)
+                points.push_back(ImPlotPoint(x, block.YMax));
+        }
+        else {
+            series.DecodeBlock(b, &points);
+        }
+    }
+    getter.Points = points.Data;
+    getter.Count  = points.Size;
+}
 
-    int YAxis;
-};
+// Pulls new points from a data provider into the item's cache if the view (X range and plot width) or data version changed
+// since the last completed request. An incomplete request leaves the cache untouched, so the last result stays visible and
+// the request is repeated next frame. Consumes the next item data version, since the cached bounds follow the view instead.
+inline void UpdateProviderPoints(ImPlotItem* item, ImPlotDataProvider provider, void* user_data) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotRange& range = gp.CurrentPlot->XAxis.Range;
+    const int width   = (int)gp.BB_Plot.GetWidth();
+    // the version keys the provider cache, the item's data bounds change with the view and are not cached
+    const int version = gp.ItemDataVersion;
+    gp.ItemDataVersion = -1;
+    if (item->ProviderValid && item->ProviderRange.Min == range.Min && item->ProviderRange.Max == range.Max &&
+        item->ProviderWidth == width && item->ProviderVersion == version)
+        return;
+    gp.ProviderBuffer.resize(0);
+    if (provider(user_data, range.Min, range.Max, width, &gp.ProviderBuffer)) {
+        item->ProviderPoints.swap(gp.ProviderBuffer);
+        item->ProviderRange   = range;
+        item->ProviderWidth   = width;
+        item->ProviderVersion = version;
+        item->ProviderValid   = true;
+    }
+}
 
-// Transforms points for linear x and log y space
-struct TransformerLinLog {
-    TransformerLinLog(int y_axis) : YAxis(y_axis) {}
+//-----------------------------------------------------------------------------
+// PLOT LINES / MARKERS
+//-----------------------------------------------------------------------------
 
-    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
-    inline ImVec2 operator()(double x, double y) {
-        ImPlotContext& gp = *GImPlot;
-        double t = ImLog10(y / gp.CurrentPlot->YAxis[YAxis].Range.Min) / gp.LogDenY[YAxis];
-        y        = ImLerp(gp.CurrentPlot->YAxis[YAxis].Range.Min, gp.CurrentPlot->YAxis[YAxis].Range.Max, (float)t);
-        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min)),
-                       (float)(gp.PixelRange[YAxis].Min.y + gp.My[YAxis] * (y - gp.CurrentPlot->YAxis[YAxis].Range.Min)) );
-    }
-    int YAxis;
-};
+// float
+void PlotLine(const char* label_id, const float* values, int count, int offset, int stride) {
+    GetterYs<float> getter(values,count,offset,stride);
+    PlotEx(label_id, getter);
+}
 
-// Transforms points for log x and log y space
-struct TransformerLogLog {
-    TransformerLogLog(int y_axis) : YAxis(y_axis) {}
+void PlotLine(const char* label_id, const float* xs, const float* ys, int count, int offset, int stride) {
+    GetterXsYs<float> getter(xs,ys,count,offset,stride);
+    return PlotEx(label_id, getter);
+}
 
-    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
-    inline ImVec2 operator()(double x, double y) {
-        ImPlotContext& gp = *GImPlot;
-        double t = ImLog10(x / gp.CurrentPlot->XAxis.Range.Min) / gp.LogDenX;
-        x        = ImLerp(gp.CurrentPlot->XAxis.Range.Min, gp.CurrentPlot->XAxis.Range.Max, (float)t);
-        t        = ImLog10(y / gp.CurrentPlot->YAxis[YAxis].Range.Min) / gp.LogDenY[YAxis];
-        y        = ImLerp(gp.CurrentPlot->YAxis[YAxis].Range.Min, gp.CurrentPlot->YAxis[YAxis].Range.Max, (float)t);
-        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min)),
-                       (float)(gp.PixelRange[YAxis].Min.y + gp.My[YAxis] * (y - gp.CurrentPlot->YAxis[YAxis].Range.Min)) );
-    }
+void PlotLine(const char* label_id, const ImVec2* data, int count, int offset) {
+    GetterImVec2 getter(data, count, offset);
+    return PlotEx(label_id, getter);
+}
 
-    int YAxis;
-};
 
-//-----------------------------------------------------------------------------
-// PRIMITIVE RENDERERS
-//-----------------------------------------------------------------------------
+// double
+void PlotLine(const char* label_id, const double* values, int count, int offset, int stride) {
+    GetterYs<double> getter(values,count,offset,stride);
+    PlotEx(label_id, getter);
+}
 
-template <typename TGetter, typename TTransformer>
-struct LineRenderer {
-    inline LineRenderer(TGetter getter, TTransformer transformer, ImU32 col, float weight) :
-        Getter(getter),
-        Transformer(transformer)
-    {
-        Prims = Getter.Count - 1;
-        Col = col;
-        Weight = weight;
-        P1 = Transformer(Getter(0));
-    }
-    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
-        ImPlotContext& gp = *GImPlot;
-        ImVec2 P2 = Transformer(Getter(prim + 1));
-        if (!gp.BB_Plot.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
-            P1 = P2;
-            return false;
-        }
-        float dx = P2.x - P1.x;
-        float dy = P2.y - P1.y;
-        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-        dx *= (Weight * 0.5f);
-        dy *= (Weight * 0.5f);
-        DrawList._VtxWritePtr[0].pos.x = P1.x + dy;
-        DrawList._VtxWritePtr[0].pos.y = P1.y - dx;
-        DrawList._VtxWritePtr[0].uv    = uv;
-        DrawList._VtxWritePtr[0].col   = Col;
-        DrawList._VtxWritePtr[1].pos.x = P2.x + dy;
-        DrawList._VtxWritePtr[1].pos.y = P2.y - dx;
-        DrawList._VtxWritePtr[1].uv    = uv;
-        DrawList._VtxWritePtr[1].col   = Col;
-        DrawList._VtxWritePtr[2].pos.x = P2.x - dy;
-        DrawList._VtxWritePtr[2].pos.y = P2.y + dx;
-        DrawList._VtxWritePtr[2].uv    = uv;
-        DrawList._VtxWritePtr[2].col   = Col;
-        DrawList._VtxWritePtr[3].pos.x = P1.x - dy;
-        DrawList._VtxWritePtr[3].pos.y = P1.y + dx;
-        DrawList._VtxWritePtr[3].uv    = uv;
-        DrawList._VtxWritePtr[3].col   = Col;
-        DrawList._VtxWritePtr += 4;
-        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
-        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
-        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
-        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
-        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
-        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
-        DrawList._IdxWritePtr += 6;
-        DrawList._VtxCurrentIdx += 4;
-        P1 = P2;
-        return true;
-    }
-    TGetter Getter;
-    TTransformer Transformer;
-    int Prims;
-    ImU32 Col;
-    float Weight;
-    ImVec2 P1;
-    static const int IdxConsumed = 6;
-    static const int VtxConsumed = 4;
-};
+void PlotLine(const char* label_id, const double* xs, const double* ys, int count, int offset, int stride) {
+    GetterXsYs<double> getter(xs,ys,count,offset,stride);
+    return PlotEx(label_id, getter);
+}
 
-template <typename TGetter1, typename TGetter2, typename TTransformer>
-struct ShadedRenderer {
-    ShadedRenderer(TGetter1 getter1, TGetter2 getter2, TTransformer transformer, ImU32 col) :
-        Getter1(getter1),
-        Getter2(getter2),
-        Transformer(transformer),
-        Col(col)
-    {
-        Prims = ImMin(Getter1.Count, Getter2.Count) - 1;
-        P11 = Transformer(Getter1(0));
-        P12 = Transformer(Getter2(0));
-    }
-
-    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
-        // TODO: Culling
-        ImVec2 P21 = Transformer(Getter1(prim+1));
-        ImVec2 P22 = Transformer(Getter2(prim+1));
-        const int intersect = (P11.y > P12.y && P22.y > P21.y) || (P12.y > P11.y && P21.y > P22.y);
-        ImVec2 intersection = Intersection(P11,P21,P12,P22);
-        DrawList._VtxWritePtr[0].pos = P11;
-        DrawList._VtxWritePtr[0].uv  = uv;
-        DrawList._VtxWritePtr[0].col = Col;
-        DrawList._VtxWritePtr[1].pos = P21;
-        DrawList._VtxWritePtr[1].uv  = uv;
-        DrawList._VtxWritePtr[1].col = Col;
-        DrawList._VtxWritePtr[2].pos = intersection;
-        DrawList._VtxWritePtr[2].uv  = uv;
-        DrawList._VtxWritePtr[2].col = Col;
-        DrawList._VtxWritePtr[3].pos = P12;
-        DrawList._VtxWritePtr[3].uv  = uv;
-        DrawList._VtxWritePtr[3].col = Col;
-        DrawList._VtxWritePtr[4].pos = P22;
-        DrawList._VtxWritePtr[4].uv  = uv;
-        DrawList._VtxWritePtr[4].col = Col;
-        DrawList._VtxWritePtr += 5;
-        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
-        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1 + intersect);
-        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
-        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
-        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3 - intersect);
-        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 4);
-        DrawList._IdxWritePtr += 6;
-        DrawList._VtxCurrentIdx += 5;
-        P11 = P21;
-        P12 = P22;
-        return true;
-    }
-    TGetter1 Getter1;
-    TGetter2 Getter2;
-    TTransformer Transformer;
-    int Prims;
-    ImU32 Col;
-    ImVec2 P11, P12;
-    static const int IdxConsumed = 6;
-    static const int VtxConsumed = 5;
-};
+void PlotLine(const char* label_id, const ImPlotPoint* data, int count, int offset) {
+    GetterImPlotPoint getter(data, count, offset);
+    return PlotEx(label_id, getter);
+}
 
-template <typename TGetter, typename TTransformer>
-struct RectRenderer {
-    inline RectRenderer(TGetter getter, TTransformer transformer, ImU32 col) :
-        Getter(getter),
-        Transformer(transformer)
-    {
-        Prims = Getter.Count / 2;
-        Col = col;
-    }
-    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
-        // TODO: Culling
-        ImVec2 P1 = Transformer(Getter(2*prim));
-        ImVec2 P2 = Transformer(Getter(2*prim+1));
-        DrawList._VtxWritePtr[0].pos   = P1;
-        DrawList._VtxWritePtr[0].uv    = uv;
-        DrawList._VtxWritePtr[0].col   = Col;
-        DrawList._VtxWritePtr[1].pos.x = P1.x;
-        DrawList._VtxWritePtr[1].pos.y = P2.y;
-        DrawList._VtxWritePtr[1].uv    = uv;
-        DrawList._VtxWritePtr[1].col   = Col;
-        DrawList._VtxWritePtr[2].pos   = P2;
-        DrawList._VtxWritePtr[2].uv    = uv;
-        DrawList._VtxWritePtr[2].col   = Col;
-        DrawList._VtxWritePtr[3].pos.x = P2.x;
-        DrawList._VtxWritePtr[3].pos.y = P1.y;
-        DrawList._VtxWritePtr[3].uv    = uv;
-        DrawList._VtxWritePtr[3].col   = Col;
-        DrawList._VtxWritePtr += 4;
-        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
-        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
-        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
-        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
-        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
-        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
-        DrawList._IdxWritePtr   += 6;
-        DrawList._VtxCurrentIdx += 4;
-        return true;
-    }
-    TGetter Getter;
-    TTransformer Transformer;
-    int Prims;
-    ImU32 Col;
-    static const int IdxConsumed = 6;
-    static const int VtxConsumed = 4;
-};
 
-// Stupid way of calculating maximum index size of ImDrawIdx without integer overflow issues
-template <typename T>
-struct MaxIdx { static const unsigned int Value; };
-template <> const unsigned int MaxIdx<unsigned short>::Value = 65535;
-template <> const unsigned int MaxIdx<unsigned int>::Value   = 4294967295;
-
-/// Renders primitive shapes in bulk as efficiently as possible.
-template <typename Renderer>
-inline void RenderPrimitives(Renderer renderer, ImDrawList& DrawList) {
-    unsigned int prims        = renderer.Prims;
-    unsigned int prims_culled = 0;
-    unsigned int idx          = 0;
-    const ImVec2 uv = DrawList._Data->TexUvWhitePixel;
-    while (prims) {
-        // find how many can be reserved up to end of current draw command's limit
-        unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - DrawList._VtxCurrentIdx) / Renderer::VtxConsumed);
-        // make sure at least this many elements can be rendered to avoid situations where at the end of buffer this slow path is not taken all the time
-        if (cnt >= ImMin(64u, prims)) {
-            if (prims_culled >= cnt)
-                prims_culled -= cnt; // reuse previous reservation
-            else {
-                DrawList.PrimReserve((cnt - prims_culled) * Renderer::IdxConsumed, (cnt - prims_culled) * Renderer::VtxConsumed); // add more elements to previous reservation
-                prims_culled = 0;
-            }
-        }
-        else
-        {
-            if (prims_culled > 0) {
-                DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
-                prims_culled = 0;
-            }
-            cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - 0/*DrawList._VtxCurrentIdx*/) / Renderer::VtxConsumed);
-            DrawList.PrimReserve(cnt * Renderer::IdxConsumed, cnt * Renderer::VtxConsumed); // reserve new draw command
-        }
-        prims -= cnt;
-        for (unsigned int ie = idx + cnt; idx != ie; ++idx) {
-            if (!renderer(DrawList, uv, idx))
-                prims_culled++;
-        }
-    }
-    if (prims_culled > 0)
-        DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
+// custom
+void PlotLine(const char* label_id, ImPlotPoint (*getter_func)(void* data, int idx), void* data, int count, int offset) {
+    GetterFuncPtrImPlotPoint getter(getter_func,data, count, offset);
+    return PlotEx(label_id, getter);
 }
 
-template <typename Getter, typename Transformer>
-inline void RenderLineStrip(Getter getter, Transformer transformer, ImDrawList& DrawList, float line_weight, ImU32 col) {
-    ImPlotContext& gp = *GImPlot;
-    if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased)) {
-        ImVec2 p1 = transformer(getter(0));
-        for (int i = 0; i < getter.Count; ++i) {
-            ImVec2 p2 = transformer(getter(i));
-            if (gp.BB_Plot.Overlaps(ImRect(ImMin(p1, p2), ImMax(p1, p2))))
-                DrawList.AddLine(p1, p2, col, line_weight);
-            p1 = p2;
-        }
-    }
-    else {
-        RenderPrimitives(LineRenderer<Getter,Transformer>(getter, transformer, col, line_weight), DrawList);
-    }
+// batch getter
+void PlotLineBatch(const char* label_id, ImPlotBatchGetter getter_func, void* data, int count, int offset) {
+    GetterBatch getter(getter_func, data, count, offset);
+    PlotEx(label_id, getter);
 }
 
-//-----------------------------------------------------------------------------
-// MARKER RENDERERS
-//-----------------------------------------------------------------------------
+// ring window
+void PlotLineRing(const char* label_id, const float* xs, const float* ys, int capacity, int start, int count, int stride) {
+    IM_ASSERT_USER_ERROR(start >= 0 && start < ImMax(capacity, 1) && count >= 0 && count <= capacity, "Ring window out of bounds!");
+    GetterXsYsRing<float> getter(xs, ys, capacity, start, count, stride);
+    PlotEx(label_id, getter);
+}
 
-inline void TransformMarker(ImVec2* points, int n, const ImVec2& c, float s) {
-    for (int i = 0; i < n; ++i) {
-        points[i].x = c.x + points[i].x * s;
-        points[i].y = c.y + points[i].y * s;
-    }
+void PlotLineRing(const char* label_id, const double* xs, const double* ys, int capacity, int start, int count, int stride) {
+    IM_ASSERT_USER_ERROR(start >= 0 && start < ImMax(capacity, 1) && count >= 0 && count <= capacity, "Ring window out of bounds!");
+    GetterXsYsRing<double> getter(xs, ys, capacity, start, count, stride);
+    PlotEx(label_id, getter);
 }
 
-inline void MarkerGeneral(ImDrawList& DrawList, ImVec2* points, int n, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    TransformMarker(points, n, c, s);
-    if (fill)
-        DrawList.AddConvexPolyFilled(points, n, col_fill);
-    if (outline && !(fill && col_outline == col_fill)) {
-        for (int i = 0; i < n; ++i)
-            DrawList.AddLine(points[i], points[(i+1)%n], col_outline, weight);
-    }
+// 64-bit count and offset
+template <typename Getter>
+inline void PlotLine64Ex(const char* label_id, const Getter& getter) {
+    if (getter.Size > INT_MAX)
+        PlotEx(label_id, GetterMinMax64<Getter>(getter));
+    else
+        PlotEx(label_id, getter);
 }
 
-inline void MarkerCircle(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    ImVec2 marker[10] = {ImVec2(1.0f, 0.0f),
-                         ImVec2(0.809017f, 0.58778524f),
-                         ImVec2(0.30901697f, 0.95105654f),
-                         ImVec2(-0.30901703f, 0.9510565f),
-                         ImVec2(-0.80901706f, 0.5877852f),
-                         ImVec2(-1.0f, 0.0f),
-                         ImVec2(-0.80901694f, -0.58778536f),
-                         ImVec2(-0.3090171f, -0.9510565f),
-                         ImVec2(0.30901712f, -0.9510565f),
-                         ImVec2(0.80901694f, -0.5877853f)};
-    MarkerGeneral(DrawList, marker, 10, c, s, outline, col_outline, fill, col_fill, weight);
+void PlotLine64(const char* label_id, const float* values, ImS64 count, ImS64 offset, int stride) {
+    GetterYs64<float> getter(values,count,offset,stride);
+    PlotLine64Ex(label_id, getter);
 }
 
-inline void MarkerDiamond(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    ImVec2 marker[4] = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
-    MarkerGeneral(DrawList, marker, 4, c, s, outline, col_outline, fill, col_fill, weight);
+void PlotLine64(const char* label_id, const float* xs, const float* ys, ImS64 count, ImS64 offset, int stride) {
+    GetterXsYs64<float> getter(xs,ys,count,offset,stride);
+    PlotLine64Ex(label_id, getter);
 }
 
-inline void MarkerSquare(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    ImVec2 marker[4] = {ImVec2(SQRT_1_2,SQRT_1_2),ImVec2(SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,SQRT_1_2)};
-    MarkerGeneral(DrawList, marker, 4, c, s, outline, col_outline, fill, col_fill, weight);
+void PlotLine64(const char* label_id, const double* values, ImS64 count, ImS64 offset, int stride) {
+    GetterYs64<double> getter(values,count,offset,stride);
+    PlotLine64Ex(label_id, getter);
 }
 
-inline void MarkerUp(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    ImVec2 marker[3] = {ImVec2(SQRT_3_2,0.5f),ImVec2(0,-1),ImVec2(-SQRT_3_2,0.5f)};
-    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+void PlotLine64(const char* label_id, const double* xs, const double* ys, ImS64 count, ImS64 offset, int stride) {
+    GetterXsYs64<double> getter(xs,ys,count,offset,stride);
+    PlotLine64Ex(label_id, getter);
 }
 
-inline void MarkerDown(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    ImVec2 marker[3] = {ImVec2(SQRT_3_2,-0.5f),ImVec2(0,1),ImVec2(-SQRT_3_2,-0.5f)};
-    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+// uniform (implicit X = x0 + idx * dx)
+void PlotLineUniform(const char* label_id, const float* values, int count, double x0, double dx, int offset, int stride) {
+    GetterYsUniform<float> getter(values, count, x0, dx, offset, stride);
+    PlotEx(label_id, getter);
 }
 
-inline void MarkerLeft(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    ImVec2 marker[3] = {ImVec2(-1,0), ImVec2(0.5, SQRT_3_2), ImVec2(0.5, -SQRT_3_2)};
-    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+void PlotLineUniform(const char* label_id, const double* values, int count, double x0, double dx, int offset, int stride) {
+    GetterYsUniform<double> getter(values, count, x0, dx, offset, stride);
+    PlotEx(label_id, getter);
 }
 
-inline void MarkerRight(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
-    ImVec2 marker[3] = {ImVec2(1,0), ImVec2(-0.5, SQRT_3_2), ImVec2(-0.5, -SQRT_3_2)};
-    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+// provider
+void PlotLineProvider(const char* label_id, ImPlotDataProvider provider, void* user_data) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotLineProvider() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlotItem* item = RegisterOrGetItem(label_id);
+    if (item->Show)
+        UpdateProviderPoints(item, provider, user_data);
+    GetterImPlotPoint getter(item->ProviderPoints.Data, item->ProviderPoints.Size, 0);
+    PlotItemEx(item, getter);
 }
 
-inline void MarkerAsterisk(ImDrawList& DrawList, const ImVec2& c, float s, bool /*outline*/, ImU32 col_outline, bool /*fill*/, ImU32 /*col_fill*/, float weight) {
-    ImVec2 marker[6] = {ImVec2(SQRT_3_2, 0.5f), ImVec2(0, -1), ImVec2(-SQRT_3_2, 0.5f), ImVec2(SQRT_3_2, -0.5f), ImVec2(0, 1),  ImVec2(-SQRT_3_2, -0.5f)};
-    TransformMarker(marker, 6, c, s);
-    DrawList.AddLine(marker[0], marker[5], col_outline, weight);
-    DrawList.AddLine(marker[1], marker[4], col_outline, weight);
-    DrawList.AddLine(marker[2], marker[3], col_outline, weight);
+// compressed series
+void PlotLineCompressed(const char* label_id, const ImPlotCompressedSeries& series) {
+    GetterCompressed getter(&series);
+    PlotEx(label_id, getter);
 }
 
-inline void MarkerPlus(ImDrawList& DrawList, const ImVec2& c, float s, bool /*outline*/, ImU32 col_outline, bool /*fill*/, ImU32 /*col_fill*/, float weight) {
-    ImVec2 marker[4] = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
-    TransformMarker(marker, 4, c, s);
-    DrawList.AddLine(marker[0], marker[2], col_outline, weight);
-    DrawList.AddLine(marker[1], marker[3], col_outline, weight);
+// quantized series
+void PlotLineQuantized(const char* label_id, const ImPlotQuantizedSeries& series) {
+    GetterQuantized getter(&series);
+    PlotEx(label_id, getter);
 }
 
-inline void MarkerCross(ImDrawList& DrawList, const ImVec2& c, float s, bool /*outline*/, ImU32 col_outline, bool /*fill*/, ImU32 /*col_fill*/, float weight) {
-    ImVec2 marker[4] = {ImVec2(SQRT_1_2,SQRT_1_2),ImVec2(SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,SQRT_1_2)};
-    TransformMarker(marker, 4, c, s);
-    DrawList.AddLine(marker[0], marker[2], col_outline, weight);
-    DrawList.AddLine(marker[1], marker[3], col_outline, weight);
+// memory mapped file
+template <typename T>
+inline void PlotLineMappedEx(const char* label_id, const ImPlotMappedFile& file, size_t header, int stride, double x0, double dx) {
+    // the last sample only needs its own bytes, not a full stride
+    const ImS64 size = file.Data != NULL && file.Size >= header + sizeof(T) ? (ImS64)((file.Size - header - sizeof(T)) / stride) + 1 : 0;
+    GetterMapped<T> getter((const unsigned char*)file.Data + header, stride, size, x0, dx);
+    PlotEx(label_id, getter);
 }
 
-template <typename Transformer, typename Getter>
-inline void RenderMarkers(Getter getter, Transformer transformer, ImDrawList& DrawList, bool rend_mk_line, ImU32 col_mk_line, bool rend_mk_fill, ImU32 col_mk_fill) {
-    ImPlotContext& gp = *GImPlot;
-    for (int i = 0; i < getter.Count; ++i) {
-        ImVec2 c = transformer(getter(i));
-        if (gp.BB_Plot.Contains(c)) {
-            // TODO: Optimize the loop and if statements, this is atrocious
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Circle))
-                MarkerCircle(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Square))
-                MarkerSquare(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Diamond))
-                MarkerDiamond(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Up))
-                MarkerUp(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Down))
-                MarkerDown(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Left))
-                MarkerLeft(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Right))
-                MarkerRight(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Cross))
-                MarkerCross(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Plus))
-                MarkerPlus(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Asterisk))
-                MarkerAsterisk(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
-        }
+void PlotLineMapped(const char* label_id, const ImPlotMappedFile& file, ImGuiDataType type, size_t header, int stride, double x0, double dx) {
+    IM_ASSERT_USER_ERROR(type >= ImGuiDataType_S8 && type <= ImGuiDataType_Double, "Unsupported data type!");
+    IM_ASSERT_USER_ERROR(stride > 0, "Stride must be greater than zero!");
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL, "PlotLineMapped() needs to be called between BeginPlot() and EndPlot()!");
+    switch (type) {
+        case ImGuiDataType_S8:     PlotLineMappedEx<ImS8>(label_id, file, header, stride, x0, dx);   break;
+        case ImGuiDataType_U8:     PlotLineMappedEx<ImU8>(label_id, file, header, stride, x0, dx);   break;
+        case ImGuiDataType_S16:    PlotLineMappedEx<ImS16>(label_id, file, header, stride, x0, dx);  break;
+        case ImGuiDataType_U16:    PlotLineMappedEx<ImU16>(label_id, file, header, stride, x0, dx);  break;
+        case ImGuiDataType_S32:    PlotLineMappedEx<ImS32>(label_id, file, header, stride, x0, dx);  break;
+        case ImGuiDataType_U32:    PlotLineMappedEx<ImU32>(label_id, file, header, stride, x0, dx);  break;
+        case ImGuiDataType_S64:    PlotLineMappedEx<ImS64>(label_id, file, header, stride, x0, dx);  break;
+        case ImGuiDataType_U64:    PlotLineMappedEx<ImU64>(label_id, file, header, stride, x0, dx);  break;
+        case ImGuiDataType_Float:  PlotLineMappedEx<float>(label_id, file, header, stride, x0, dx);  break;
+        case ImGuiDataType_Double: PlotLineMappedEx<double>(label_id, file, header, stride, x0, dx); break;
+        default: break;
     }
 }
 
-//-----------------------------------------------------------------------------
-// PLOT LINES / MARKERS
-//-----------------------------------------------------------------------------
+// time (int64 nanosecond timestamps)
+template <typename TS, typename T>
+inline void PlotLineTimeEx(const char* label_id, const TS* ts_ns, const T* ys, int count, int offset, int ts_stride, int y_stride) {
+    GetterTimeYs<TS,T> getter(ts_ns, ys, count, offset, ts_stride, y_stride, GetTimeOrigin(ts_ns, count, offset, ts_stride));
+    PlotEx(label_id, getter);
+}
 
-template <typename Getter>
-inline void PlotEx(const char* label_id, Getter getter)
-{
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotEx() needs to be called between BeginPlot() and EndPlot()!");
+void PlotLineTime(const char* label_id, const ImS64* ts_ns, const float* ys, int count, int offset, int ts_stride, int y_stride) {
+    PlotLineTimeEx(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+}
 
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
-    TryRecolorItem(item, ImPlotCol_Line);
+void PlotLineTime(const char* label_id, const ImS64* ts_ns, const double* ys, int count, int offset, int ts_stride, int y_stride) {
+    PlotLineTimeEx(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+}
 
-    // find data extents
-    if (gp.FitThisFrame) {
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPoint p = getter(i);
-            FitPoint(p);
-        }
-    }
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotLineTime(const char* label_id, const long* ts_ns, const float* ys, int count, int offset, int ts_stride, int y_stride) {
+    PlotLineTimeEx(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+}
 
-    ImDrawList& DrawList = *ImGui::GetWindowDrawList();
-    ImPlotState* plot = gp.CurrentPlot;
-    const int y_axis = plot->CurrentYAxis;
+void PlotLineTime(const char* label_id, const long* ts_ns, const double* ys, int count, int offset, int ts_stride, int y_stride) {
+    PlotLineTimeEx(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+}
+#endif
 
-    PushPlotClipRect();
-    // render line
-    if (getter.Count > 1 && WillLineRender()) {
-        ImU32 col_line = ImGui::GetColorU32(GetLineColor(item));
-        const float line_weight = item->Highlight ? gp.Style.LineWeight * 2 : gp.Style.LineWeight;
-        if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-            RenderLineStrip(getter, TransformerLogLog(y_axis), DrawList, line_weight, col_line);
-        else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
-            RenderLineStrip(getter, TransformerLogLin(y_axis), DrawList, line_weight, col_line);
-        else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-            RenderLineStrip(getter, TransformerLinLog(y_axis), DrawList, line_weight, col_line);
-        else
-            RenderLineStrip(getter, TransformerLinLin(y_axis), DrawList, line_weight, col_line);
-    }
-    // render markers
-    if (gp.Style.Marker != ImPlotMarker_None) {
-        const bool rend_mk_line = WillMarkerOutlineRender();
-        const bool rend_mk_fill = WillMarkerFillRender();
-        const ImU32 col_mk_line = ImGui::GetColorU32(GetMarkerOutlineColor(item));
-        const ImU32 col_mk_fill = ImGui::GetColorU32(GetMarkerFillColor(item));
-        if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-            RenderMarkers(getter, TransformerLogLog(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
-        else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
-            RenderMarkers(getter, TransformerLogLin(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
-        else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-            RenderMarkers(getter, TransformerLinLog(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
-        else
-            RenderMarkers(getter, TransformerLinLin(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
+// integer (read in place, Y values are scaled and biased by the getter)
+#define IMPLOT_DEFINE_PLOT_LINE_INTEGER(T)                                                                                     \
+void PlotLine(const char* label_id, const T* values, int count, int offset, int stride, double scale, double bias) {           \
+    GetterYsScaled<T> getter(values, count, offset, stride, scale, bias);                                                      \
+    PlotEx(label_id, getter);                                                                                                  \
+}                                                                                                                              \
+void PlotLine(const char* label_id, const T* xs, const T* ys, int count, int offset, int stride, double scale, double bias) {  \
+    GetterXsYsScaled<T> getter(xs, ys, count, offset, stride, scale, bias);                                                    \
+    PlotEx(label_id, getter);                                                                                                  \
+}
+
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImS8)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImU8)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImS16)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImU16)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImS32)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImU32)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImS64)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(ImU64)
+#ifdef IMPLOT_LONG_IS_64BIT
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(long)
+IMPLOT_DEFINE_PLOT_LINE_INTEGER(unsigned long)
+#endif
+
+// scalar (independent X/Y types and strides). The data types are dispatched once here, not per point.
+template <typename TX>
+inline void PlotLineScalarEx(const char* label_id, const void* xs, int x_stride, ImGuiDataType y_type, const void* ys, int y_stride, int count, int offset) {
+    switch (y_type) {
+        case ImGuiDataType_S8:     PlotEx(label_id, GetterXsYsScalar<TX,ImS8>(xs, x_stride, ys, y_stride, count, offset));   break;
+        case ImGuiDataType_U8:     PlotEx(label_id, GetterXsYsScalar<TX,ImU8>(xs, x_stride, ys, y_stride, count, offset));   break;
+        case ImGuiDataType_S16:    PlotEx(label_id, GetterXsYsScalar<TX,ImS16>(xs, x_stride, ys, y_stride, count, offset));  break;
+        case ImGuiDataType_U16:    PlotEx(label_id, GetterXsYsScalar<TX,ImU16>(xs, x_stride, ys, y_stride, count, offset));  break;
+        case ImGuiDataType_S32:    PlotEx(label_id, GetterXsYsScalar<TX,ImS32>(xs, x_stride, ys, y_stride, count, offset));  break;
+        case ImGuiDataType_U32:    PlotEx(label_id, GetterXsYsScalar<TX,ImU32>(xs, x_stride, ys, y_stride, count, offset));  break;
+        case ImGuiDataType_S64:    PlotEx(label_id, GetterXsYsScalar<TX,ImS64>(xs, x_stride, ys, y_stride, count, offset));  break;
+        case ImGuiDataType_U64:    PlotEx(label_id, GetterXsYsScalar<TX,ImU64>(xs, x_stride, ys, y_stride, count, offset));  break;
+        case ImGuiDataType_Float:  PlotEx(label_id, GetterXsYsScalar<TX,float>(xs, x_stride, ys, y_stride, count, offset));  break;
+        case ImGuiDataType_Double: PlotEx(label_id, GetterXsYsScalar<TX,double>(xs, x_stride, ys, y_stride, count, offset)); break;
+        default: break;
     }
-    PopPlotClipRect();
 }
 
+void PlotLineScalar(const char* label_id, ImGuiDataType x_type, const void* xs, int x_stride, ImGuiDataType y_type, const void* ys, int y_stride, int count, int offset) {
+    IM_ASSERT_USER_ERROR(x_type >= ImGuiDataType_S8 && x_type <= ImGuiDataType_Double && y_type >= ImGuiDataType_S8 && y_type <= ImGuiDataType_Double, "Unsupported data type!");
+    switch (x_type) {
+        case ImGuiDataType_S8:     PlotLineScalarEx<ImS8>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);   break;
+        case ImGuiDataType_U8:     PlotLineScalarEx<ImU8>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);   break;
+        case ImGuiDataType_S16:    PlotLineScalarEx<ImS16>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);  break;
+        case ImGuiDataType_U16:    PlotLineScalarEx<ImU16>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);  break;
+        case ImGuiDataType_S32:    PlotLineScalarEx<ImS32>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);  break;
+        case ImGuiDataType_U32:    PlotLineScalarEx<ImU32>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);  break;
+        case ImGuiDataType_S64:    PlotLineScalarEx<ImS64>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);  break;
+        case ImGuiDataType_U64:    PlotLineScalarEx<ImU64>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);  break;
+        case ImGuiDataType_Float:  PlotLineScalarEx<float>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset);  break;
+        case ImGuiDataType_Double: PlotLineScalarEx<double>(label_id, xs, x_stride, y_type, ys, y_stride, count, offset); break;
+        default: break;
+    }
+}
 
-// float
-void PlotLine(const char* label_id, const float* values, int count, int offset, int stride) {
+// item handle
+void PlotLine(const ImPlotItemHandle& handle, const float* values, int count, int offset, int stride) {
     GetterYs<float> getter(values,count,offset,stride);
-    PlotEx(label_id, getter);
+    PlotEx(handle, getter);
 }
 
-void PlotLine(const char* label_id, const float* xs, const float* ys, int count, int offset, int stride) {
+void PlotLine(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, int offset, int stride) {
     GetterXsYs<float> getter(xs,ys,count,offset,stride);
-    return PlotEx(label_id, getter);
+    return PlotEx(handle, getter);
 }
 
-void PlotLine(const char* label_id, const ImVec2* data, int count, int offset) {
+void PlotLine(const ImPlotItemHandle& handle, const ImVec2* data, int count, int offset) {
     GetterImVec2 getter(data, count, offset);
-    return PlotEx(label_id, getter);
+    return PlotEx(handle, getter);
 }
 
-
-// double
-void PlotLine(const char* label_id, const double* values, int count, int offset, int stride) {
+void PlotLine(const ImPlotItemHandle& handle, const double* values, int count, int offset, int stride) {
     GetterYs<double> getter(values,count,offset,stride);
-    PlotEx(label_id, getter);
+    PlotEx(handle, getter);
 }
 
-void PlotLine(const char* label_id, const double* xs, const double* ys, int count, int offset, int stride) {
+void PlotLine(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, int offset, int stride) {
     GetterXsYs<double> getter(xs,ys,count,offset,stride);
-    return PlotEx(label_id, getter);
+    return PlotEx(handle, getter);
 }
 
-void PlotLine(const char* label_id, const ImPlotPoint* data, int count, int offset) {
+void PlotLine(const ImPlotItemHandle& handle, const ImPlotPoint* data, int count, int offset) {
     GetterImPlotPoint getter(data, count, offset);
-    return PlotEx(label_id, getter);
+    return PlotEx(handle, getter);
 }
 
+void PlotLine(const ImPlotItemHandle& handle, ImPlotPoint (*getter_func)(void* data, int idx), void* data, int count, int offset) {
+    GetterFuncPtrImPlotPoint getter(getter_func,data, count, offset);
+    return PlotEx(handle, getter);
+}
+
+//-----------------------------------------------------------------------------
+// PLOT SCATTER
+//-----------------------------------------------------------------------------
+
+// float
+void PlotScatter(const char* label_id, const float* values, int count, int offset, int stride) {
+    int vars = PushScatterStyle();
+    PlotLine(label_id, values, count, offset, stride);
+    PopStyleVar(vars);
+}
+
+void PlotScatter(const char* label_id, const float* xs, const float* ys, int count, int offset, int stride) {
+    int vars = PushScatterStyle();
+    PlotLine(label_id, xs, ys, count, offset, stride);
+    PopStyleVar(vars);
+}
+
+void PlotScatter(const char* label_id, const ImVec2* data, int count, int offset) {
+    int vars = PushScatterStyle();
+    PlotLine(label_id, data, count, offset);
+    PopStyleVar(vars);
+}
+
+// double
+void PlotScatter(const char* label_id, const double* values, int count, int offset, int stride) {
+    int vars = PushScatterStyle();
+    PlotLine(label_id, values, count, offset, stride);
+    PopStyleVar(vars);
+}
+
+void PlotScatter(const char* label_id, const double* xs, const double* ys, int count, int offset, int stride) {
+    int vars = PushScatterStyle();
+    PlotLine(label_id, xs, ys, count, offset, stride);
+    PopStyleVar(vars);
+}
+
+void PlotScatter(const char* label_id, const ImPlotPoint* data, int count, int offset) {
+    int vars = PushScatterStyle();
+    PlotLine(label_id, data, count, offset);
+    PopStyleVar(vars);
+}
+
+// ring window
+void PlotScatterRing(const char* label_id, const float* xs, const float* ys, int capacity, int start, int count, int stride) {
+    int vars = PushScatterStyle();
+    PlotLineRing(label_id, xs, ys, capacity, start, count, stride);
+    PopStyleVar(vars);
+}
+
+void PlotScatterRing(const char* label_id, const double* xs, const double* ys, int capacity, int start, int count, int stride) {
+    int vars = PushScatterStyle();
+    PlotLineRing(label_id, xs, ys, capacity, start, count, stride);
+    PopStyleVar(vars);
+}
+
+// 64-bit count and offset. Every sample is drawn: above INT_MAX samples the markers are rendered in windows of INT_MAX samples.
+template <typename Getter>
+inline void PlotScatter64Ex(const char* label_id, Getter getter) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotScatter64() needs to be called between BeginPlot() and EndPlot()!");
+    int vars = PushScatterStyle();
+    if (getter.Size <= INT_MAX) {
+        PlotEx(label_id, getter);
+        PopStyleVar(vars);
+        return;
+    }
+    ImPlotItem* item = RegisterOrGetItem(label_id);
+    if (item->Show) {
+        TryRecolorItem(item, ImPlotCol_Line);
+        if (BeginItemFit(item)) {
+            for (ImS64 i = 0; i < getter.Size; ++i)
+                FitItemPoint(getter.Point(i));
+        }
+        if (EndItemFit(item)) {
+            PushPlotClipRect();
+            for (getter.Base = 0; getter.Base < getter.Size; getter.Base += getter.Count) {
+                getter.Count = (int)ImMin(getter.Size - getter.Base, (ImS64)INT_MAX);
+                RenderItemMarkers(item, getter);
+            }
+            PopPlotClipRect();
+        }
+    }
+    PopStyleVar(vars);
+}
+
+void PlotScatter64(const char* label_id, const float* values, ImS64 count, ImS64 offset, int stride) {
+    GetterYs64<float> getter(values,count,offset,stride);
+    PlotScatter64Ex(label_id, getter);
+}
+
+void PlotScatter64(const char* label_id, const float* xs, const float* ys, ImS64 count, ImS64 offset, int stride) {
+    GetterXsYs64<float> getter(xs,ys,count,offset,stride);
+    PlotScatter64Ex(label_id, getter);
+}
+
+void PlotScatter64(const char* label_id, const double* values, ImS64 count, ImS64 offset, int stride) {
+    GetterYs64<double> getter(values,count,offset,stride);
+    PlotScatter64Ex(label_id, getter);
+}
+
+void PlotScatter64(const char* label_id, const double* xs, const double* ys, ImS64 count, ImS64 offset, int stride) {
+    GetterXsYs64<double> getter(xs,ys,count,offset,stride);
+    PlotScatter64Ex(label_id, getter);
+}
 
 // custom
-void PlotLine(const char* label_id, ImPlotPoint (*getter_func)(void* data, int idx), void* data, int count, int offset) {
-    GetterFuncPtrImPlotPoint getter(getter_func,data, count, offset);
-    return PlotEx(label_id, getter);
+void PlotScatter(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset) {
+    int vars = PushScatterStyle();
+    PlotLine(label_id, getter, data, count, offset);
+    PopStyleVar(vars);
+}
+
+// batch getter
+void PlotScatterBatch(const char* label_id, ImPlotBatchGetter getter, void* data, int count, int offset) {
+    int vars = PushScatterStyle();
+    PlotLineBatch(label_id, getter, data, count, offset);
+    PopStyleVar(vars);
+}
+
+// provider
+void PlotScatterProvider(const char* label_id, ImPlotDataProvider provider, void* user_data) {
+    int vars = PushScatterStyle();
+    PlotLineProvider(label_id, provider, user_data);
+    PopStyleVar(vars);
+}
+
+// time
+void PlotScatterTime(const char* label_id, const ImS64* ts_ns, const float* ys, int count, int offset, int ts_stride, int y_stride) {
+    int vars = PushScatterStyle();
+    PlotLineTime(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+    PopStyleVar(vars);
+}
+
+void PlotScatterTime(const char* label_id, const ImS64* ts_ns, const double* ys, int count, int offset, int ts_stride, int y_stride) {
+    int vars = PushScatterStyle();
+    PlotLineTime(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+    PopStyleVar(vars);
+}
+
+#ifdef IMPLOT_LONG_IS_64BIT
+void PlotScatterTime(const char* label_id, const long* ts_ns, const float* ys, int count, int offset, int ts_stride, int y_stride) {
+    int vars = PushScatterStyle();
+    PlotLineTime(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+    PopStyleVar(vars);
+}
+
+void PlotScatterTime(const char* label_id, const long* ts_ns, const double* ys, int count, int offset, int ts_stride, int y_stride) {
+    int vars = PushScatterStyle();
+    PlotLineTime(label_id, ts_ns, ys, count, offset, ts_stride, y_stride);
+    PopStyleVar(vars);
 }
+#endif
 
-//-----------------------------------------------------------------------------
-// PLOT SCATTER
-//-----------------------------------------------------------------------------
+// integer
+#define IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(T)                                                                                  \
+void PlotScatter(const char* label_id, const T* values, int count, int offset, int stride, double scale, double bias) {        \
+    int vars = PushScatterStyle();                                                                                             \
+    PlotLine(label_id, values, count, offset, stride, scale, bias);                                                            \
+    PopStyleVar(vars);                                                                                                         \
+}                                                                                                                              \
+void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, int offset, int stride, double scale, double bias) { \
+    int vars = PushScatterStyle();                                                                                             \
+    PlotLine(label_id, xs, ys, count, offset, stride, scale, bias);                                                            \
+    PopStyleVar(vars);                                                                                                         \
+}
+
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImS8)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImU8)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImS16)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImU16)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImS32)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImU32)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImS64)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(ImU64)
+#ifdef IMPLOT_LONG_IS_64BIT
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(long)
+IMPLOT_DEFINE_PLOT_SCATTER_INTEGER(unsigned long)
+#endif
 
-inline int PushScatterStyle() {
-    int vars = 1;
-    PushStyleVar(ImPlotStyleVar_LineWeight, 0);
-    if (GetStyle().Marker == ImPlotMarker_None) {
-        PushStyleVar(ImPlotStyleVar_Marker, ImPlotMarker_Circle);
-        vars++;
-    }
-    return vars;
+// scalar
+void PlotScatterScalar(const char* label_id, ImGuiDataType x_type, const void* xs, int x_stride, ImGuiDataType y_type, const void* ys, int y_stride, int count, int offset) {
+    int vars = PushScatterStyle();
+    PlotLineScalar(label_id, x_type, xs, x_stride, y_type, ys, y_stride, count, offset);
+    PopStyleVar(vars);
 }
 
-// float
-void PlotScatter(const char* label_id, const float* values, int count, int offset, int stride) {
+// item handle
+void PlotScatter(const ImPlotItemHandle& handle, const float* values, int count, int offset, int stride) {
     int vars = PushScatterStyle();
-    PlotLine(label_id, values, count, offset, stride);
+    PlotLine(handle, values, count, offset, stride);
     PopStyleVar(vars);
 }
 
-void PlotScatter(const char* label_id, const float* xs, const float* ys, int count, int offset, int stride) {
+void PlotScatter(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, int offset, int stride) {
     int vars = PushScatterStyle();
-    PlotLine(label_id, xs, ys, count, offset, stride);
+    PlotLine(handle, xs, ys, count, offset, stride);
     PopStyleVar(vars);
 }
 
-void PlotScatter(const char* label_id, const ImVec2* data, int count, int offset) {
+void PlotScatter(const ImPlotItemHandle& handle, const ImVec2* data, int count, int offset) {
     int vars = PushScatterStyle();
-    PlotLine(label_id, data, count, offset);
+    PlotLine(handle, data, count, offset);
     PopStyleVar(vars);
 }
 
-// double
-void PlotScatter(const char* label_id, const double* values, int count, int offset, int stride) {
+void PlotScatter(const ImPlotItemHandle& handle, const double* values, int count, int offset, int stride) {
     int vars = PushScatterStyle();
-    PlotLine(label_id, values, count, offset, stride);
+    PlotLine(handle, values, count, offset, stride);
     PopStyleVar(vars);
 }
 
-void PlotScatter(const char* label_id, const double* xs, const double* ys, int count, int offset, int stride) {
+void PlotScatter(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, int offset, int stride) {
     int vars = PushScatterStyle();
-    PlotLine(label_id, xs, ys, count, offset, stride);
+    PlotLine(handle, xs, ys, count, offset, stride);
     PopStyleVar(vars);
 }
 
-void PlotScatter(const char* label_id, const ImPlotPoint* data, int count, int offset) {
+void PlotScatter(const ImPlotItemHandle& handle, const ImPlotPoint* data, int count, int offset) {
     int vars = PushScatterStyle();
-    PlotLine(label_id, data, count, offset);
+    PlotLine(handle, data, count, offset);
     PopStyleVar(vars);
 }
 
-
-// custom
-void PlotScatter(const char* label_id, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset) {
+void PlotScatter(const ImPlotItemHandle& handle, ImPlotPoint (*getter)(void* data, int idx), void* data, int count, int offset) {
     int vars = PushScatterStyle();
-    PlotLine(label_id, getter, data, count, offset);
+    PlotLine(handle, getter, data, count, offset);
     PopStyleVar(vars);
 }
 
@@ -777,47 +1186,6 @@ void PlotScatter(const char* label_id, ImPlotPoint (*getter)(void* data, int idx
 // PLOT SHADED
 //-----------------------------------------------------------------------------
 
-template <typename Getter1, typename Getter2>
-inline void PlotShadedEx(const char* label_id, Getter1 getter1, Getter2 getter2) {
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotShaded() needs to be called between BeginPlot() and EndPlot()!");
-
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
-    TryRecolorItem(item, ImPlotCol_Fill);
-
-    if (!WillFillRender())
-        return;
-
-    // find data extents
-    if (gp.FitThisFrame) {
-        for (int i = 0; i < ImMin(getter1.Count, getter2.Count); ++i) {
-            ImPlotPoint p1 = getter1(i);
-            ImPlotPoint p2 = getter2(i);
-            FitPoint(p1);
-            FitPoint(p2);
-        }
-    }
-
-    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
-    ImPlotState* plot = gp.CurrentPlot;
-    const int y_axis = plot->CurrentYAxis;
-
-    ImU32 col = ImGui::GetColorU32(GetItemFillColor(item));
-
-    PushPlotClipRect();
-    if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-        RenderPrimitives(ShadedRenderer<Getter1,Getter2,TransformerLogLog>(getter1,getter2,TransformerLogLog(y_axis), col), DrawList);
-    else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
-        RenderPrimitives(ShadedRenderer<Getter1,Getter2,TransformerLogLin>(getter1,getter2,TransformerLogLin(y_axis), col), DrawList);
-    else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-        RenderPrimitives(ShadedRenderer<Getter1,Getter2,TransformerLinLog>(getter1,getter2,TransformerLinLog(y_axis), col), DrawList);
-    else
-        RenderPrimitives(ShadedRenderer<Getter1,Getter2,TransformerLinLin>(getter1,getter2,TransformerLinLin(y_axis), col), DrawList);
-    PopPlotClipRect();
-}
-
 // float
 
 void PlotShaded(const char* label_id, const float* values, int count, float y_ref, int offset, int stride) {
@@ -863,53 +1231,66 @@ void PlotShaded(const char* label_id, ImPlotPoint (*g1)(void* data, int idx), vo
     PlotShadedEx(label_id, getter1, getter2);
 }
 
-//-----------------------------------------------------------------------------
-// PLOT BAR V
-//-----------------------------------------------------------------------------
+// uniform
+void PlotShadedUniform(const char* label_id, const float* values, int count, double x0, double dx, double y_ref, int offset, int stride) {
+    GetterYsUniform<float> getter1(values, count, x0, dx, offset, stride);
+    GetterYRefUniform getter2(y_ref, count, x0, dx);
+    PlotShadedEx(label_id, getter1, getter2);
+}
 
-template <typename Getter, typename TWidth>
-void PlotBarsEx(const char* label_id, Getter getter, TWidth width) {
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotBars() needs to be called between BeginPlot() and EndPlot()!");
+void PlotShadedUniform(const char* label_id, const double* values, int count, double x0, double dx, double y_ref, int offset, int stride) {
+    GetterYsUniform<double> getter1(values, count, x0, dx, offset, stride);
+    GetterYRefUniform getter2(y_ref, count, x0, dx);
+    PlotShadedEx(label_id, getter1, getter2);
+}
 
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
-    TryRecolorItem(item, ImPlotCol_Fill);
+// item handle
+void PlotShaded(const ImPlotItemHandle& handle, const float* values, int count, float y_ref, int offset, int stride) {
+    GetterYs<float> getter1(values,count,offset,stride);
+    GetterYRef<float> getter2(y_ref, count);
+    PlotShadedEx(handle, getter1, getter2);
+}
 
-    const TWidth half_width = width / 2;
-    // find data extents
-    if (gp.FitThisFrame) {
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPoint p = getter(i);
-            FitPoint(ImPlotPoint(p.x - half_width, p.y));
-            FitPoint(ImPlotPoint(p.x + half_width, 0));
-        }
-    }
+void PlotShaded(const ImPlotItemHandle& handle, const float* xs, const float* ys1, const float* ys2, int count, int offset, int stride) {
+    GetterXsYs<float> getter1(xs, ys1, count, offset, stride);
+    GetterXsYs<float> getter2(xs, ys2, count, offset, stride);
+    PlotShadedEx(handle, getter1, getter2);
+}
 
-    ImU32 col_line = ImGui::GetColorU32(GetLineColor(item));
-    ImU32 col_fill = ImGui::GetColorU32(GetItemFillColor(item));
-    const bool rend_fill = WillFillRender();
-    bool rend_line       = WillLineRender();
-    if (rend_fill && col_line == col_fill)
-        rend_line = false;
+void PlotShaded(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, float y_ref, int offset, int stride) {
+    GetterXsYs<float> getter1(xs, ys, count, offset, stride);
+    GetterXsYRef<float> getter2(xs, y_ref, count, offset, stride);
+    PlotShadedEx(handle, getter1, getter2);
+}
 
-    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
-    PushPlotClipRect();
-    for (int i = 0; i < getter.Count; ++i) {
-        ImPlotPoint p = getter(i);
-        if (p.y == 0)
-            continue;
-        ImVec2 a = PlotToPixels(p.x - half_width, p.y);
-        ImVec2 b = PlotToPixels(p.x + half_width, 0);
-        if (rend_fill)
-            DrawList.AddRectFilled(a, b, col_fill);
-        if (rend_line)
-            DrawList.AddRect(a, b, col_line, 0, ImDrawCornerFlags_All, gp.Style.LineWeight);
-    }
-    PopPlotClipRect();
+void PlotShaded(const ImPlotItemHandle& handle, const double* values, int count, double y_ref, int offset, int stride) {
+    GetterYs<double> getter1(values,count,offset,stride);
+    GetterYRef<double> getter2(y_ref, count);
+    PlotShadedEx(handle, getter1, getter2);
+}
+
+void PlotShaded(const ImPlotItemHandle& handle, const double* xs, const double* ys1, const double* ys2, int count, int offset, int stride) {
+    GetterXsYs<double> getter1(xs, ys1, count, offset, stride);
+    GetterXsYs<double> getter2(xs, ys2, count, offset, stride);
+    PlotShadedEx(handle, getter1, getter2);
+}
+
+void PlotShaded(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, double y_ref, int offset, int stride) {
+    GetterXsYs<double> getter1(xs, ys, count, offset, stride);
+    GetterXsYRef<double> getter2(xs, y_ref, count, offset, stride);
+    PlotShadedEx(handle, getter1, getter2);
+}
+
+void PlotShaded(const ImPlotItemHandle& handle, ImPlotPoint (*g1)(void* data, int idx), void* data1, ImPlotPoint (*g2)(void* data, int idx), void* data2, int count, int offset) {
+    GetterFuncPtrImPlotPoint getter1(g1, data1, count, offset);
+    GetterFuncPtrImPlotPoint getter2(g2, data2, count, offset);
+    PlotShadedEx(handle, getter1, getter2);
 }
 
+//-----------------------------------------------------------------------------
+// PLOT BAR V
+//-----------------------------------------------------------------------------
+
 // float
 void PlotBars(const char* label_id, const float* values, int count, float width, float shift, int offset, int stride) {
     GetterBarV<float> getter(values,shift,count,offset,stride);
@@ -938,55 +1319,36 @@ void PlotBars(const char* label_id, ImPlotPoint (*getter_func)(void* data, int i
     PlotBarsEx(label_id, getter, width);
 }
 
-//-----------------------------------------------------------------------------
-// PLOT BAR H
-//-----------------------------------------------------------------------------
-
-// TODO: Migrate to RenderPrimitives
-
-template <typename Getter, typename THeight>
-void PlotBarsHEx(const char* label_id, Getter getter, THeight height) {
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotBarsH() needs to be called between BeginPlot() and EndPlot()!");
+// item handle
+void PlotBars(const ImPlotItemHandle& handle, const float* values, int count, float width, float shift, int offset, int stride) {
+    GetterBarV<float> getter(values,shift,count,offset,stride);
+    PlotBarsEx(handle, getter, width);
+}
 
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
-    TryRecolorItem(item, ImPlotCol_Fill);
+void PlotBars(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, float width, int offset, int stride) {
+    GetterXsYs<float> getter(xs,ys,count,offset,stride);
+    PlotBarsEx(handle, getter, width);
+}
 
-    const THeight half_height = height / 2;
-    // find data extents
-    if (gp.FitThisFrame) {
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPoint p = getter(i);
-            FitPoint(ImPlotPoint(0, p.y - half_height));
-            FitPoint(ImPlotPoint(p.x, p.y + half_height));
-        }
-    }
+void PlotBars(const ImPlotItemHandle& handle, const double* values, int count, double width, double shift, int offset, int stride) {
+    GetterBarV<double> getter(values,shift,count,offset,stride);
+    PlotBarsEx(handle, getter, width);
+}
 
-    ImU32 col_line = ImGui::GetColorU32(GetLineColor(item));
-    ImU32 col_fill = ImGui::GetColorU32(GetItemFillColor(item));
-    const bool rend_fill = WillFillRender();
-    bool rend_line       = WillLineRender();
-    if (rend_fill && col_line == col_fill)
-        rend_line = false;
+void PlotBars(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, double width, int offset, int stride) {
+    GetterXsYs<double> getter(xs,ys,count,offset,stride);
+    PlotBarsEx(handle, getter, width);
+}
 
-    PushPlotClipRect();
-    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
-    for (int i = 0; i < getter.Count; ++i) {
-        ImPlotPoint p = getter(i);
-        if (p.x == 0)
-            continue;
-        ImVec2 a = PlotToPixels(0, p.y - half_height);
-        ImVec2 b = PlotToPixels(p.x, p.y + half_height);
-        if (rend_fill)
-            DrawList.AddRectFilled(a, b, col_fill);
-        if (rend_line)
-            DrawList.AddRect(a, b, col_line, 0, ImDrawCornerFlags_All, gp.Style.LineWeight);
-    }
-    PopPlotClipRect();
+void PlotBars(const ImPlotItemHandle& handle, ImPlotPoint (*getter_func)(void* data, int idx), void* data, int count, double width, int offset) {
+    GetterFuncPtrImPlotPoint getter(getter_func, data, count, offset);
+    PlotBarsEx(handle, getter, width);
 }
 
+//-----------------------------------------------------------------------------
+// PLOT BAR H
+//-----------------------------------------------------------------------------
+
 // float
 void PlotBarsH(const char* label_id, const float* values, int count, float height, float shift, int offset, int stride) {
     GetterBarH<float> getter(values,shift,count,offset,stride);
@@ -1015,48 +1377,36 @@ void PlotBarsH(const char* label_id, ImPlotPoint (*getter_func)(void* data, int
     PlotBarsHEx(label_id, getter, height);
 }
 
-//-----------------------------------------------------------------------------
-// PLOT ERROR BARS
-//-----------------------------------------------------------------------------
-
-template <typename Getter>
-void PlotErrorBarsEx(const char* label_id, Getter getter) {
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotErrorBars() needs to be called between BeginPlot() and EndPlot()!");
-
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
+// item handle
+void PlotBarsH(const ImPlotItemHandle& handle, const float* values, int count, float height, float shift, int offset, int stride) {
+    GetterBarH<float> getter(values,shift,count,offset,stride);
+    PlotBarsHEx(handle, getter, height);
+}
 
-    // find data extents
-    if (gp.FitThisFrame) {
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPointError e = getter(i);
-            FitPoint(ImPlotPoint(e.X , e.Y - e.Neg));
-            FitPoint(ImPlotPoint(e.X , e.Y + e.Pos ));
-        }
-    }
+void PlotBarsH(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, float height,  int offset, int stride) {
+    GetterXsYs<float> getter(xs,ys,count,offset,stride);
+    PlotBarsHEx(handle, getter, height);
+}
 
-    const ImU32 col = ImGui::GetColorU32(GetErrorBarColor());
-    const bool rend_whisker = gp.Style.ErrorBarSize > 0;
-    const float half_whisker = gp.Style.ErrorBarSize * 0.5f;
+void PlotBarsH(const ImPlotItemHandle& handle, const double* values, int count, double height, double shift, int offset, int stride) {
+    GetterBarH<double> getter(values,shift,count,offset,stride);
+    PlotBarsHEx(handle, getter, height);
+}
 
-    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
+void PlotBarsH(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, double height,  int offset, int stride) {
+    GetterXsYs<double> getter(xs,ys,count,offset,stride);
+    PlotBarsHEx(handle, getter, height);
+}
 
-    PushPlotClipRect();
-    for (int i = 0; i < getter.Count; ++i) {
-        ImPlotPointError e = getter(i);
-        ImVec2 p1 = PlotToPixels(e.X, e.Y - e.Neg);
-        ImVec2 p2 = PlotToPixels(e.X, e.Y + e.Pos);
-        DrawList.AddLine(p1,p2,col, gp.Style.ErrorBarWeight);
-        if (rend_whisker) {
-            DrawList.AddLine(p1 - ImVec2(half_whisker, 0), p1 + ImVec2(half_whisker, 0), col, gp.Style.ErrorBarWeight);
-            DrawList.AddLine(p2 - ImVec2(half_whisker, 0), p2 + ImVec2(half_whisker, 0), col, gp.Style.ErrorBarWeight);
-        }
-    }
-    PopPlotClipRect();
+void PlotBarsH(const ImPlotItemHandle& handle, ImPlotPoint (*getter_func)(void* data, int idx), void* data, int count, double height,  int offset) {
+    GetterFuncPtrImPlotPoint getter(getter_func, data, count, offset);
+    PlotBarsHEx(handle, getter, height);
 }
 
+//-----------------------------------------------------------------------------
+// PLOT ERROR BARS
+//-----------------------------------------------------------------------------
+
 // float
 void PlotErrorBars(const char* label_id, const float* xs, const float* ys, const float* err, int count, int offset, int stride) {
     GetterError<float> getter(xs, ys, err, err, count, offset, stride);
@@ -1079,48 +1429,31 @@ void PlotErrorBars(const char* label_id, const double* xs, const double* ys, con
     PlotErrorBarsEx(label_id, getter);
 }
 
-//-----------------------------------------------------------------------------
-// PLOT ERROR BARS H
-//-----------------------------------------------------------------------------
-
-template <typename Getter>
-void PlotErrorBarsHEx(const char* label_id, Getter getter) {
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotErrorBarsH() needs to be called between BeginPlot() and EndPlot()!");
-
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
-
-    // find data extents
-    if (gp.FitThisFrame) {
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPointError e = getter(i);
-            FitPoint(ImPlotPoint(e.X - e.Neg, e.Y));
-            FitPoint(ImPlotPoint(e.X + e.Pos, e.Y));
-        }
-    }
+// item handle
+void PlotErrorBars(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* err, int count, int offset, int stride) {
+    GetterError<float> getter(xs, ys, err, err, count, offset, stride);
+    PlotErrorBarsEx(handle, getter);
+}
 
-    const ImU32 col = ImGui::GetColorU32(GetErrorBarColor());
-    const bool rend_whisker = gp.Style.ErrorBarSize > 0;
-    const float half_whisker = gp.Style.ErrorBarSize * 0.5f;
+void PlotErrorBars(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* neg, const float* pos, int count, int offset, int stride) {
+    GetterError<float> getter(xs, ys, neg, pos, count, offset, stride);
+    PlotErrorBarsEx(handle, getter);
+}
 
-    ImDrawList& DrawList = *ImGui::GetWindowDrawList();
+void PlotErrorBars(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* err, int count, int offset, int stride) {
+    GetterError<double> getter(xs, ys, err, err, count, offset, stride);
+    PlotErrorBarsEx(handle, getter);
+}
 
-    PushPlotClipRect();
-    for (int i = 0; i < getter.Count; ++i) {
-        ImPlotPointError e = getter(i);
-        ImVec2 p1 = PlotToPixels(e.X - e.Neg, e.Y);
-        ImVec2 p2 = PlotToPixels(e.X + e.Pos, e.Y);
-        DrawList.AddLine(p1, p2, col, gp.Style.ErrorBarWeight);
-        if (rend_whisker) {
-            DrawList.AddLine(p1 - ImVec2(0, half_whisker), p1 + ImVec2(0, half_whisker), col, gp.Style.ErrorBarWeight);
-            DrawList.AddLine(p2 - ImVec2(0, half_whisker), p2 + ImVec2(0, half_whisker), col, gp.Style.ErrorBarWeight);
-        }
-    }
-    PopPlotClipRect();
+void PlotErrorBars(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* neg, const double* pos, int count, int offset, int stride) {
+    GetterError<double> getter(xs, ys, neg, pos, count, offset, stride);
+    PlotErrorBarsEx(handle, getter);
 }
 
+//-----------------------------------------------------------------------------
+// PLOT ERROR BARS H
+//-----------------------------------------------------------------------------
+
 // float
 void PlotErrorBarsH(const char* label_id, const float* xs, const float* ys, const float* err, int count, int offset, int stride) {
     GetterError<float> getter(xs, ys, err, err, count, offset, stride);
@@ -1143,6 +1476,27 @@ void PlotErrorBarsH(const char* label_id, const double* xs, const double* ys, co
     PlotErrorBarsHEx(label_id, getter);
 }
 
+// item handle
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* err, int count, int offset, int stride) {
+    GetterError<float> getter(xs, ys, err, err, count, offset, stride);
+    PlotErrorBarsHEx(handle, getter);
+}
+
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const float* xs, const float* ys, const float* neg, const float* pos, int count, int offset, int stride) {
+    GetterError<float> getter(xs, ys, neg, pos, count, offset, stride);
+    PlotErrorBarsHEx(handle, getter);
+}
+
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* err, int count, int offset, int stride) {
+    GetterError<double> getter(xs, ys, err, err, count, offset, stride);
+    PlotErrorBarsHEx(handle, getter);
+}
+
+void PlotErrorBarsH(const ImPlotItemHandle& handle, const double* xs, const double* ys, const double* neg, const double* pos, int count, int offset, int stride) {
+    GetterError<double> getter(xs, ys, neg, pos, count, offset, stride);
+    PlotErrorBarsHEx(handle, getter);
+}
+
 //-----------------------------------------------------------------------------
 // PLOT PIE CHART
 //-----------------------------------------------------------------------------
@@ -1271,18 +1625,24 @@ void RenderHeatmap(Transformer transformer, ImDrawList& DrawList, const T* value
     }
 }
 
-template <typename T>
-void PlotHeatmapEx(const char* label_id, const T* values, int rows, int cols, T scale_min, T scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
+template <typename ItemId, typename T>
+void PlotHeatmapEx(const ItemId& item_id, const T* values, int rows, int cols, T scale_min, T scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotHeatmap() needs to be called between BeginPlot() and EndPlot()!");
     IM_ASSERT_USER_ERROR(scale_min != scale_max, "Scale values must be different!");
-    ImPlotItem* item = RegisterOrGetItem(label_id);
+    ImPlotItem* item = RegisterOrGetItem(item_id);
     if (!item->Show)
         return;
     if (gp.FitThisFrame) {
         FitPoint(bounds_min);
         FitPoint(bounds_max);
     }
+    // heatmap bounds are known up front, so they can always be culled
+    ImPlotLimits bounds;
+    bounds.X = ImPlotRange(ImMin(bounds_min.x, bounds_max.x), ImMax(bounds_min.x, bounds_max.x));
+    bounds.Y = ImPlotRange(ImMin(bounds_min.y, bounds_max.y), ImMax(bounds_min.y, bounds_max.y));
+    if (!IsInView(bounds))
+        return;
     ImDrawList& DrawList = *ImGui::GetWindowDrawList();
     ImGui::PushClipRect(gp.BB_Plot.Min, gp.BB_Plot.Max, true);
     ImPlotState* plot = gp.CurrentPlot;
@@ -1308,74 +1668,19 @@ void PlotHeatmap(const char* label_id, const double* values, int rows, int cols,
     return PlotHeatmapEx(label_id, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max);
 }
 
+// item handle
+void PlotHeatmap(const ImPlotItemHandle& handle, const float* values, int rows, int cols, float scale_min, float scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
+    return PlotHeatmapEx(handle, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max);
+}
+
+void PlotHeatmap(const ImPlotItemHandle& handle, const double* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
+    return PlotHeatmapEx(handle, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max);
+}
+
 //-----------------------------------------------------------------------------
 // PLOT DIGITAL
 //-----------------------------------------------------------------------------
 
-template <typename Getter>
-inline void PlotDigitalEx(const char* label_id, Getter getter)
-{
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotDigital() needs to be called between BeginPlot() and EndPlot()!");
-
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
-    TryRecolorItem(item, ImPlotCol_Line);
-
-    // render digital signals as "pixel bases" rectangles
-    PushPlotClipRect();
-    if (getter.Count > 1 && WillLineRender()) {
-        ImDrawList & DrawList = *ImGui::GetWindowDrawList();
-        const float line_weight = item->Highlight ? gp.Style.LineWeight * 2 : gp.Style.LineWeight;
-        const int y_axis = gp.CurrentPlot->CurrentYAxis;
-        int pixYMax = 0;
-        ImPlotPoint itemData1 = getter(0);
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPoint itemData2 = getter(i);
-            if (NanOrInf(itemData1.y)) {
-                itemData1 = itemData2;
-                continue;
-            }
-            if (NanOrInf(itemData2.y)) itemData2.y = ConstrainNan(ConstrainInf(itemData2.y));
-            int pixY_0 = (int)(line_weight);
-            itemData1.y = ImMax(0.0, itemData1.y);
-            float pixY_1_float = gp.Style.DigitalBitHeight * (float)itemData1.y;
-            int pixY_1 = (int)(pixY_1_float); //allow only positive values
-            int pixY_chPosOffset = (int)(ImMax(gp.Style.DigitalBitHeight, pixY_1_float) + gp.Style.DigitalBitGap);
-            pixYMax = ImMax(pixYMax, pixY_chPosOffset);
-            ImVec2 pMin = PlotToPixels(itemData1);
-            ImVec2 pMax = PlotToPixels(itemData2);
-            int pixY_Offset = 20; //20 pixel from bottom due to mouse cursor label
-            pMin.y = (gp.PixelRange[y_axis].Min.y) + ((-gp.DigitalPlotOffset)                   - pixY_Offset);
-            pMax.y = (gp.PixelRange[y_axis].Min.y) + ((-gp.DigitalPlotOffset) - pixY_0 - pixY_1 - pixY_Offset);
-            //plot only one rectangle for same digital state
-            while (((i+2) < getter.Count) && (itemData1.y == itemData2.y)) {
-                const int in = (i + 1);
-                itemData2 = getter(in);
-                if (NanOrInf(itemData2.y)) break;
-                pMax.x = PlotToPixels(itemData2).x;
-                i++;
-            }
-            //do not extend plot outside plot range
-            if (pMin.x < gp.PixelRange[y_axis].Min.x) pMin.x = gp.PixelRange[y_axis].Min.x;
-            if (pMax.x < gp.PixelRange[y_axis].Min.x) pMax.x = gp.PixelRange[y_axis].Min.x;
-            if (pMin.x > gp.PixelRange[y_axis].Max.x) pMin.x = gp.PixelRange[y_axis].Max.x;
-            if (pMax.x > gp.PixelRange[y_axis].Max.x) pMax.x = gp.PixelRange[y_axis].Max.x;
-            //plot a rectangle that extends up to x2 with y1 height
-            if ((pMax.x > pMin.x) && (gp.BB_Plot.Contains(pMin) || gp.BB_Plot.Contains(pMax))) {
-                ImVec4 colAlpha = item->Color;
-                colAlpha.w = item->Highlight ? 1.0f : 0.9f;
-                DrawList.AddRectFilled(pMin, pMax, ImGui::GetColorU32(colAlpha));
-            }
-            itemData1 = itemData2;
-        }
-        gp.DigitalPlotItemCnt++;
-        gp.DigitalPlotOffset += pixYMax;
-    }
-    PopPlotClipRect();
-}
-
 // float
 void PlotDigital(const char* label_id, const float* xs, const float* ys, int count, int offset, int stride) {
     GetterXsYs<float> getter(xs,ys,count,offset,stride);
@@ -1394,46 +1699,37 @@ void PlotDigital(const char* label_id, ImPlotPoint (*getter_func)(void* data, in
     return PlotDigitalEx(label_id, getter);
 }
 
-//-----------------------------------------------------------------------------
-// PLOT RECTS
-//-----------------------------------------------------------------------------
-template <typename Getter>
-void PlotRectsEx(const char* label_id, Getter getter) {
-    ImPlotContext& gp = *GImPlot;
-    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotRects() needs to be called between BeginPlot() and EndPlot()!");
-
-    ImPlotItem* item = RegisterOrGetItem(label_id);
-    if (!item->Show)
-        return;
-    TryRecolorItem(item, ImPlotCol_Fill);
+// uniform
+void PlotDigitalUniform(const char* label_id, const float* values, int count, double x0, double dx, int offset, int stride) {
+    GetterYsUniform<float> getter(values, count, x0, dx, offset, stride);
+    return PlotDigitalEx(label_id, getter);
+}
 
-    if (!WillFillRender())
-        return;
+void PlotDigitalUniform(const char* label_id, const double* values, int count, double x0, double dx, int offset, int stride) {
+    GetterYsUniform<double> getter(values, count, x0, dx, offset, stride);
+    return PlotDigitalEx(label_id, getter);
+}
 
-    if (gp.FitThisFrame) {
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPoint p = getter(i);
-            FitPoint(p);
-        }
-    }
+// item handle
+void PlotDigital(const ImPlotItemHandle& handle, const float* xs, const float* ys, int count, int offset, int stride) {
+    GetterXsYs<float> getter(xs,ys,count,offset,stride);
+    return PlotDigitalEx(handle, getter);
+}
 
-    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
-    ImPlotState* plot = gp.CurrentPlot;
-    const int y_axis = plot->CurrentYAxis;
-    ImU32 col = ImGui::GetColorU32(GetItemFillColor(item));
+void PlotDigital(const ImPlotItemHandle& handle, const double* xs, const double* ys, int count, int offset, int stride) {
+    GetterXsYs<double> getter(xs,ys,count,offset,stride);
+    return PlotDigitalEx(handle, getter);
+}
 
-    PushPlotClipRect();
-    if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-        RenderPrimitives(RectRenderer<Getter,TransformerLogLog>(getter, TransformerLogLog(y_axis), col), DrawList);
-    else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
-        RenderPrimitives(RectRenderer<Getter,TransformerLogLin>(getter, TransformerLogLin(y_axis), col), DrawList);
-    else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
-        RenderPrimitives(RectRenderer<Getter,TransformerLinLog>(getter, TransformerLinLog(y_axis), col), DrawList);
-    else
-        RenderPrimitives(RectRenderer<Getter,TransformerLinLin>(getter, TransformerLinLin(y_axis), col), DrawList);
-    PopPlotClipRect();
+void PlotDigital(const ImPlotItemHandle& handle, ImPlotPoint (*getter_func)(void* data, int idx), void* data, int count, int offset) {
+    GetterFuncPtrImPlotPoint getter(getter_func,data,count,offset);
+    return PlotDigitalEx(handle, getter);
 }
 
+//-----------------------------------------------------------------------------
+// PLOT RECTS
+//-----------------------------------------------------------------------------
+
 // float
 void PlotRects(const char* label_id, const float* xs, const float* ys, int count, int offset, int stride) {
     GetterXsYs<float> getter(xs,ys,count,offset,stride);
@@ -0,0 +1,342 @@
+// MIT License
+
+// Copyright (c) 2020 Evan Pezent
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// ImPlot v0.5 WIP
+
+// Optional header with buffer types for live and long-running data. It is kept
+// apart from implot.h because it depends on C++11 <atomic>.
+
+#pragma once
+#include "implot.h"
+#include "implot_internal.h"
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+// Forward Declarations and Basic Types
+//-----------------------------------------------------------------------------
+
+// The maximum number of tiers of an ImPlotHistoryBuffer
+#define IMPLOT_HISTORY_MAX_TIERS 8
+
+typedef int ImPlotRetention; // -> enum ImPlotRetention_
+
+// How much history an ImPlotStreamBuffer retains.
+enum ImPlotRetention_ {
+    ImPlotRetention_Count, // keep the last N points
+    ImPlotRetention_Time   // keep the points whose X value lies within the last N units of the newest X value (X must be increasing)
+};
+
+//-----------------------------------------------------------------------------
+// ImPlotStreamBuffer
+//-----------------------------------------------------------------------------
+
+// Bounded lock-free single-producer/single-consumer ring of points. One thread appends with AddPoint() (e.g. an acquisition
+// thread at MHz rates) while the render thread calls Update() once per frame and plots the resulting snapshot in place with
+// ImPlot::PlotLine(label_id, buffer). The producer never overwrites points inside the consumer's snapshot; if the ring is full
+// the new point is dropped and counted instead. Size the capacity for the retained window plus one frame worth of points
+// (count retention keeps the last capacity / 2 points by default).
+template <typename T>
+struct ImPlotStreamBuffer {
+    ImVector<T>         Xs;        // ring storage for X values
+    ImVector<T>         Ys;        // ring storage for Y values
+    int                 Capacity;  // number of points the ring can hold
+    ImPlotRetention     Retention; // retention policy
+    double              Window;    // retained points (ImPlotRetention_Count) or X span (ImPlotRetention_Time)
+    int                 SnapStart; // ring index of the oldest point in the current snapshot (consumer only)
+    int                 SnapCount; // number of points in the current snapshot (consumer only)
+    std::atomic<ImS64>  Head;      // total number of points ever added (written by the producer)
+    std::atomic<ImS64>  Tail;      // total number of points released by the consumer (written by the consumer)
+    std::atomic<ImS64>  Dropped;   // number of points dropped because the ring was full
+
+    ImPlotStreamBuffer(int capacity, ImPlotRetention retention = ImPlotRetention_Count, double window = 0) : Head(0), Tail(0), Dropped(0) {
+        IM_ASSERT(capacity > 0);
+        Xs.resize(capacity);
+        Ys.resize(capacity);
+        Capacity  = capacity;
+        Retention = retention;
+        Window    = (retention == ImPlotRetention_Count && window <= 0) ? capacity / 2 : window;
+        SnapStart = SnapCount = 0;
+        // the producer needs free slots to make progress, so count retention must keep fewer points than the ring holds
+        IM_ASSERT(retention != ImPlotRetention_Count || (Window >= 1 && Window < Capacity));
+    }
+
+    // Appends a point. Producer thread only. Returns false if the ring is full and the point was dropped.
+    bool AddPoint(T x, T y) {
+        const ImS64 head = Head.load(std::memory_order_relaxed);
+        if (head - Tail.load(std::memory_order_acquire) >= Capacity) {
+            Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const int i = (int)(head % Capacity);
+        Xs.Data[i] = x;
+        Ys.Data[i] = y;
+        Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Releases points outside of the retention window and takes a consistent snapshot of the rest. Consumer thread only,
+    // typically once per frame before plotting. The snapshot stays valid until the next call.
+    void Update() {
+        const ImS64 head = Head.load(std::memory_order_acquire);
+        ImS64 tail = Tail.load(std::memory_order_relaxed);
+        if (Retention == ImPlotRetention_Count) {
+            const ImS64 keep = (ImS64)Window;
+            if (head - tail > keep)
+                tail = head - keep;
+        }
+        else if (head > tail) {
+            const double x_min = (double)Xs.Data[(int)((head - 1) % Capacity)] - Window;
+            while (tail < head && (double)Xs.Data[(int)(tail % Capacity)] < x_min)
+                ++tail;
+            // the window holds more points than the ring, release the oldest half so the producer isn't stalled
+            if (head - tail >= Capacity)
+                tail = head - Capacity / 2;
+        }
+        Tail.store(tail, std::memory_order_release);
+        SnapStart = (int)(tail % Capacity);
+        SnapCount = (int)(head - tail);
+    }
+
+private:
+    ImPlotStreamBuffer(const ImPlotStreamBuffer&);
+    ImPlotStreamBuffer& operator=(const ImPlotStreamBuffer&);
+};
+
+//-----------------------------------------------------------------------------
+// ImPlotHistoryBuffer
+//-----------------------------------------------------------------------------
+
+// History buffer for long-running live plots. The newest points are kept at full resolution in a ring, while every point is
+// also rolled into progressively decimated min/max tiers (e.g. 1x, 10x, 100x, ...) that each hold a ring of buckets. Memory is
+// bounded, yet the whole history stays plottable: ImPlot::PlotLine/PlotShaded(label_id, buffer) picks, for each part of the
+// visible X range, the coarsest tier that still has at least one bucket per pixel. X values must be increasing. Not thread-safe.
+template <typename T>
+struct ImPlotHistoryBuffer {
+    struct Tier {
+        ImVector<T> Xs, Mins, Maxs;       // ring storage (Maxs is empty for the full resolution tier)
+        int         Start, Count;         // ring window
+        T           PendX, PendMin, PendMax;
+        int         PendN;                // number of inputs accumulated into the pending bucket
+    };
+    Tier Tiers[IMPLOT_HISTORY_MAX_TIERS]; // Tiers[0] is full resolution, Tiers[k] buckets Factor^k points
+    int  TierCount;                       // number of tiers in use
+    int  Factor;                          // decimation factor between consecutive tiers
+
+    // #raw_capacity points are kept at full resolution, each of the #tiers - 1 decimated tiers keeps #tier_capacity buckets.
+    ImPlotHistoryBuffer(int raw_capacity, int tier_capacity, int tiers = 3, int factor = 10) {
+        IM_ASSERT(raw_capacity > 0 && tier_capacity > 0 && tiers > 0 && tiers <= IMPLOT_HISTORY_MAX_TIERS && factor > 1);
+        Factor    = factor;
+        TierCount = tiers;
+        for (int k = 0; k < tiers; ++k) {
+            Tier& t = Tiers[k];
+            const int cap = k == 0 ? raw_capacity : tier_capacity;
+            t.Xs.resize(cap);
+            t.Mins.resize(cap);
+            if (k > 0)
+                t.Maxs.resize(cap);
+            t.Start = t.Count = t.PendN = 0;
+        }
+    }
+
+    // Appends a point and rolls it into the decimated tiers.
+    void AddPoint(T x, T y) {
+        Push(Tiers[0], x, y, y);
+        T bx = x, bmin = y, bmax = y;
+        for (int k = 1; k < TierCount; ++k) {
+            Tier& t = Tiers[k];
+            if (t.PendN == 0) {
+                t.PendX = bx; t.PendMin = bmin; t.PendMax = bmax;
+            }
+            else {
+                t.PendMin = bmin < t.PendMin ? bmin : t.PendMin;
+                t.PendMax = bmax > t.PendMax ? bmax : t.PendMax;
+            }
+            if (++t.PendN < Factor)
+                break;
+            Push(t, t.PendX, t.PendMin, t.PendMax);
+            bx = t.PendX; bmin = t.PendMin; bmax = t.PendMax;
+            t.PendN = 0;
+        }
+    }
+
+    // Accessors for the ith oldest entry of tier #k.
+    T X(int k, int i) const   { const Tier& t = Tiers[k]; return t.Xs.Data[Wrap(t, i)]; }
+    T Min(int k, int i) const { const Tier& t = Tiers[k]; return t.Mins.Data[Wrap(t, i)]; }
+    T Max(int k, int i) const { const Tier& t = Tiers[k]; return k == 0 ? t.Mins.Data[Wrap(t, i)] : t.Maxs.Data[Wrap(t, i)]; }
+
+    // Returns the index of the first entry of tier #k with X >= #x.
+    int LowerBound(int k, double x) const {
+        int lo = 0, hi = Tiers[k].Count;
+        while (lo < hi) {
+            const int mid = (lo + hi) / 2;
+            if ((double)X(k, mid) < x) lo = mid + 1;
+            else                       hi = mid;
+        }
+        return lo;
+    }
+
+    // Returns the average X spacing of the entries of tier #k, or 0 if it has fewer than two.
+    double Spacing(int k) const {
+        const Tier& t = Tiers[k];
+        return t.Count > 1 ? ((double)X(k, t.Count - 1) - (double)X(k, 0)) / (t.Count - 1) : 0;
+    }
+
+    // Computes the X/Y extents of the whole history from every tier. Returns false if the buffer is empty.
+    bool GetExtents(ImPlotLimits& ext) const {
+        ext.X = ext.Y = ImPlotRange(DBL_MAX, -DBL_MAX);
+        for (int k = 0; k < TierCount; ++k) {
+            for (int i = 0; i < Tiers[k].Count; ++i) {
+                const double x = (double)X(k, i), mn = (double)Min(k, i), mx = (double)Max(k, i);
+                ext.X.Min = x  < ext.X.Min ? x  : ext.X.Min;
+                ext.X.Max = x  > ext.X.Max ? x  : ext.X.Max;
+                ext.Y.Min = mn < ext.Y.Min ? mn : ext.Y.Min;
+                ext.Y.Max = mx > ext.Y.Max ? mx : ext.Y.Max;
+            }
+        }
+        return ext.X.Min <= ext.X.Max;
+    }
+
+    // Fills xs/mins/maxs with the entries to draw for the X range [x_min, x_max] across #pixel_width pixels.
+    void Select(double x_min, double x_max, float pixel_width, ImVector<double>& xs, ImVector<double>& mins, ImVector<double>& maxs) const {
+        xs.resize(0); mins.resize(0); maxs.resize(0);
+        const double px = (x_max - x_min) / (pixel_width > 1 ? pixel_width : 1);
+        // tier k is the finest tier covering [X(k,0), X(k-1,0)); walk the segments from the oldest (coarsest) to the newest
+        for (int k = TierCount - 1; k >= 0; --k) {
+            if (Tiers[k].Count == 0)
+                continue;
+            double seg_lo = (double)X(k, 0);
+            double seg_hi = DBL_MAX;
+            for (int f = k - 1; f >= 0; --f) {
+                if (Tiers[f].Count > 0) {
+                    seg_hi = (double)X(f, 0);
+                    break;
+                }
+            }
+            if (seg_hi <= seg_lo)
+                continue;
+            // all tiers >= k cover this segment: use the coarsest one that still has at least one bucket per pixel
+            int use = k;
+            for (int j = TierCount - 1; j > k; --j) {
+                const double spacing = Spacing(j);
+                if (Tiers[j].Count > 1 && spacing <= px) {
+                    use = j;
+                    break;
+                }
+            }
+            const double lo = seg_lo > x_min ? seg_lo : x_min;
+            const double hi = seg_hi < x_max ? seg_hi : x_max;
+            if (hi < lo)
+                continue;
+            int i0 = LowerBound(use, lo);
+            int i1 = LowerBound(use, hi);
+            if (lo == x_min && i0 > 0)                  // extend to the plot edges
+                --i0;
+            if (hi == x_max && i1 < Tiers[use].Count)
+                ++i1;
+            for (int i = i0; i < i1; ++i) {
+                xs.push_back((double)X(use, i));
+                mins.push_back((double)Min(use, i));
+                maxs.push_back((double)Max(use, i));
+            }
+        }
+    }
+
+private:
+    static int Wrap(const Tier& t, int i) {
+        i += t.Start;
+        return i >= t.Xs.Size ? i - t.Xs.Size : i;
+    }
+    static void Push(Tier& t, T x, T mn, T mx) {
+        const int cap = t.Xs.Size;
+        int i = t.Start + t.Count;
+        if (i >= cap)
+            i -= cap;
+        t.Xs.Data[i]   = x;
+        t.Mins.Data[i] = mn;
+        if (t.Maxs.Size)
+            t.Maxs.Data[i] = mx;
+        if (t.Count < cap)
+            t.Count++;
+        else if (++t.Start == cap)
+            t.Start = 0;
+    }
+};
+
+namespace ImPlot {
+
+// Plots the current snapshot of a streaming buffer (see ImPlotStreamBuffer::Update) in place. T must be float or double.
+template <typename T>
+inline void PlotLine(const char* label_id, const ImPlotStreamBuffer<T>& buffer) {
+    PlotLineRing(label_id, buffer.Xs.Data, buffer.Ys.Data, buffer.Capacity, buffer.SnapStart, buffer.SnapCount);
+}
+
+// Plots the current snapshot of a streaming buffer (see ImPlotStreamBuffer::Update) in place. T must be float or double.
+template <typename T>
+inline void PlotScatter(const char* label_id, const ImPlotStreamBuffer<T>& buffer) {
+    PlotScatterRing(label_id, buffer.Xs.Data, buffer.Ys.Data, buffer.Capacity, buffer.SnapStart, buffer.SnapCount);
+}
+
+// Fits the plot to the whole history of #buffer (only the visible part is passed to the item) if #label_id is shown.
+template <typename T>
+inline void FitHistory(const char* label_id, const ImPlotHistoryBuffer<T>& buffer) {
+    ImPlotContext& gp = *GImPlot;
+    if (!gp.FitThisFrame)
+        return;
+    ImPlotItem* item = gp.CurrentPlot->Items.GetByKey(ImGui::GetID(label_id));
+    ImPlotLimits ext;
+    if (item != NULL && item->Show && buffer.GetExtents(ext)) {
+        FitPoint(ImPlotPoint(ext.X.Min, ext.Y.Min));
+        FitPoint(ImPlotPoint(ext.X.Max, ext.Y.Max));
+    }
+}
+
+// Plots a history buffer as a single series, choosing the decimation tier per part of the view (see ImPlotHistoryBuffer).
+// Decimated buckets are drawn as vertical min/max segments so that the envelope of the data is preserved.
+template <typename T>
+inline void PlotLine(const char* label_id, const ImPlotHistoryBuffer<T>& buffer) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotLine() needs to be called between BeginPlot() and EndPlot()!");
+    const ImPlotLimits limits = GetPlotLimits();
+    buffer.Select(limits.X.Min, limits.X.Max, GetPlotSize().x, gp.HistoryXs, gp.HistoryMins, gp.HistoryMaxs);
+    ImVector<ImPlotPoint>& points = gp.HistoryPoints;
+    points.resize(0);
+    for (int i = 0; i < gp.HistoryXs.Size; ++i) {
+        points.push_back(ImPlotPoint(gp.HistoryXs[i], gp.HistoryMins[i]));
+        if (gp.HistoryMaxs[i] != gp.HistoryMins[i])
+            points.push_back(ImPlotPoint(gp.HistoryXs[i], gp.HistoryMaxs[i]));
+    }
+    PlotLine(label_id, points.Data, points.Size);
+    FitHistory(label_id, buffer);
+}
+
+// Plots the min/max envelope of a history buffer as a shaded region (see ImPlotHistoryBuffer).
+template <typename T>
+inline void PlotShaded(const char* label_id, const ImPlotHistoryBuffer<T>& buffer) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotShaded() needs to be called between BeginPlot() and EndPlot()!");
+    const ImPlotLimits limits = GetPlotLimits();
+    buffer.Select(limits.X.Min, limits.X.Max, GetPlotSize().x, gp.HistoryXs, gp.HistoryMins, gp.HistoryMaxs);
+    PlotShaded(label_id, gp.HistoryXs.Data, gp.HistoryMins.Data, gp.HistoryMaxs.Data, gp.HistoryXs.Size);
+    FitHistory(label_id, buffer);
+}
+
+}  // namespace ImPlot
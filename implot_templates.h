@@ -0,0 +1,1303 @@
+// MIT License
+
+// Copyright (c) 2020 Evan Pezent
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// ImPlot v0.5 WIP
+
+// Optional header exposing the templated plotting machinery of implot_items.cpp, so that plots can be instantiated with
+// user getters in user translation units and get fully inlined. Like implot_internal.h, it may change between versions.
+//
+// A getter is any copyable type with a member int Count and a member operator()(int idx) returning the point at index idx:
+//
+//     struct MyGetter {
+//         const MyContainer* Data;
+//         int Count;
+//         ImPlotPoint operator()(int idx) const { return ImPlotPoint(Data->Time(idx), Data->Value(idx)); }
+//     };
+//
+//     ImPlot::PlotLine("My Data", MyGetter{&data, data.size()});
+//
+// Getters for PlotErrorBarsEx/PlotErrorBarsHEx return ImPlotPointError instead. The plotters take an item label or an
+// ImPlotItemHandle as their first argument.
+
+#pragma once
+#include "implot.h"
+#include "implot_internal.h"
+
+namespace ImPlot {
+
+static const float IMPLOT_SQRT_1_2 = 0.70710678118f;
+static const float IMPLOT_SQRT_3_2 = 0.86602540378f;
+
+// Normalizes the vector (vx,vy) in place, leaving it untouched if its length is zero.
+inline void NormalizeOverZero(float& vx, float& vy) {
+    const float d2 = vx * vx + vy * vy;
+    if (d2 > 0.0f) {
+        const float inv_len = 1.0f / ImSqrt(d2);
+        vx *= inv_len;
+        vy *= inv_len;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// TRANSFORMERS
+//-----------------------------------------------------------------------------
+
+// Transforms convert points in plot space (i.e. ImPlotPoint) to pixel space (i.e. ImVec2)
+
+// Transforms points for linear x and linear y space
+struct TransformerLinLin {
+    TransformerLinLin(int y_axis) : YAxis(y_axis) {}
+
+    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
+    inline ImVec2 operator()(double x, double y) {
+        ImPlotContext& gp = *GImPlot;
+        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min)),
+                       (float)(gp.PixelRange[YAxis].Min.y + gp.My[YAxis] * (y - gp.CurrentPlot->YAxis[YAxis].Range.Min)) );
+    }
+
+    int YAxis;
+};
+
+// Log scale transforms compute pix = pix_min + m * (log2(v) - log2(min)) with m and log2(min) cached per frame (see UpdateTransformCache)
+// and log2(v) approximated by ImFastLog2 when its error is sub-pixel for the axis. Non-positive values become NAN (gaps).
+
+// Transforms points for log x and linear y space
+struct TransformerLogLin {
+    TransformerLogLin(int y_axis) : YAxis(y_axis) {}
+
+    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
+    inline ImVec2 operator()(double x, double y) {
+        ImPlotContext& gp = *GImPlot;
+        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.LogMx * (TransformLog2(x, gp.FastLogX) - gp.Log2MinX)),
+                       (float)(gp.PixelRange[YAxis].Min.y + gp.My[YAxis] * (y - gp.CurrentPlot->YAxis[YAxis].Range.Min)) );
+    }
+
+    int YAxis;
+};
+
+// Transforms points for linear x and log y space
+struct TransformerLinLog {
+    TransformerLinLog(int y_axis) : YAxis(y_axis) {}
+
+    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
+    inline ImVec2 operator()(double x, double y) {
+        ImPlotContext& gp = *GImPlot;
+        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.Mx * (x - gp.CurrentPlot->XAxis.Range.Min)),
+                       (float)(gp.PixelRange[YAxis].Min.y + gp.LogMy[YAxis] * (TransformLog2(y, gp.FastLogY[YAxis]) - gp.Log2MinY[YAxis])) );
+    }
+    int YAxis;
+};
+
+// Transforms points for log x and log y space
+struct TransformerLogLog {
+    TransformerLogLog(int y_axis) : YAxis(y_axis) {}
+
+    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)(plt.x, plt.y); }
+    inline ImVec2 operator()(double x, double y) {
+        ImPlotContext& gp = *GImPlot;
+        return ImVec2( (float)(gp.PixelRange[YAxis].Min.x + gp.LogMx * (TransformLog2(x, gp.FastLogX) - gp.Log2MinX)),
+                       (float)(gp.PixelRange[YAxis].Min.y + gp.LogMy[YAxis] * (TransformLog2(y, gp.FastLogY[YAxis]) - gp.Log2MinY[YAxis])) );
+    }
+
+    int YAxis;
+};
+
+// Transforms points for linear x and linear y space in single precision, relative to origins rebased on the axes minimums once
+// per frame (see UpdateTransformCache). Exact for float data; only used when ImPlotContext::FltSafe says the error is sub-pixel.
+struct TransformerLinLinF {
+    TransformerLinLinF(int y_axis) {
+        ImPlotContext& gp = *GImPlot;
+        OriginX = gp.FltOriginX;         PixX = gp.FltPixX;         Mx = gp.FltMx;
+        OriginY = gp.FltOriginY[y_axis]; PixY = gp.FltPixY[y_axis]; My = gp.FltMy[y_axis];
+    }
+
+    inline ImVec2 operator()(const ImPlotPoint& plt) { return (*this)((float)plt.x, (float)plt.y); }
+    inline ImVec2 operator()(float x, float y) {
+        return ImVec2(PixX + Mx * (x - OriginX), PixY + My * (y - OriginY));
+    }
+
+    float OriginX, PixX, Mx;
+    float OriginY, PixY, My;
+};
+
+// Tells whether a getter reads single precision data, so that TransformerLinLinF can be used for it without losing precision.
+// Specialize it for your own getters over float data.
+template <typename Getter>
+struct IsFloatGetter { static const bool Value = false; };
+
+// Returns true if points of #Getter on #y_axis can be transformed with TransformerLinLinF.
+template <typename Getter>
+inline bool UseFloatTransform(int y_axis) {
+    return IsFloatGetter<Getter>::Value && GImPlot->FltSafe[y_axis];
+}
+
+//-----------------------------------------------------------------------------
+// PRIMITIVE RENDERERS
+//-----------------------------------------------------------------------------
+
+// Returns true if both coordinates of a transformed point are finite. NaN or infinite data, and non-positive data on
+// log axes, transform to non-finite pixels.
+inline bool IsFinitePixel(const ImVec2& p) {
+    return p.x - p.x == 0 && p.y - p.y == 0;
+}
+
+// Returns true if renderers must check for non-finite points, i.e. the current item was not declared finite
+// (see SetNextItemDataFinite) or a log axis is in use.
+inline bool ItemNeedsFiniteChecks() {
+    ImPlotContext& gp = *GImPlot;
+    return !gp.ItemDataFinite || ImHasFlag(gp.CurrentPlot->XAxis.Flags, ImPlotAxisFlags_LogScale)
+                              || ImHasFlag(gp.CurrentPlot->YAxis[gp.CurrentPlot->CurrentYAxis].Flags, ImPlotAxisFlags_LogScale);
+}
+
+// Writes a line segment from P1 to P2 as a single quad. Consumes 4 vertices and 6 indices.
+inline void PrimLine(ImDrawList& DrawList, const ImVec2& P1, const ImVec2& P2, float half_weight, ImU32 col, const ImVec2& uv) {
+    float dx = P2.x - P1.x;
+    float dy = P2.y - P1.y;
+    NormalizeOverZero(dx, dy);
+    dx *= half_weight;
+    dy *= half_weight;
+    DrawList._VtxWritePtr[0].pos.x = P1.x + dy;
+    DrawList._VtxWritePtr[0].pos.y = P1.y - dx;
+    DrawList._VtxWritePtr[0].uv    = uv;
+    DrawList._VtxWritePtr[0].col   = col;
+    DrawList._VtxWritePtr[1].pos.x = P2.x + dy;
+    DrawList._VtxWritePtr[1].pos.y = P2.y - dx;
+    DrawList._VtxWritePtr[1].uv    = uv;
+    DrawList._VtxWritePtr[1].col   = col;
+    DrawList._VtxWritePtr[2].pos.x = P2.x - dy;
+    DrawList._VtxWritePtr[2].pos.y = P2.y + dx;
+    DrawList._VtxWritePtr[2].uv    = uv;
+    DrawList._VtxWritePtr[2].col   = col;
+    DrawList._VtxWritePtr[3].pos.x = P1.x - dy;
+    DrawList._VtxWritePtr[3].pos.y = P1.y + dx;
+    DrawList._VtxWritePtr[3].uv    = uv;
+    DrawList._VtxWritePtr[3].col   = col;
+    DrawList._VtxWritePtr += 4;
+    DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+    DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+    DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+    DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+    DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+    DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+    DrawList._IdxWritePtr += 6;
+    DrawList._VtxCurrentIdx += 4;
+}
+
+// Writes an anti-aliased line segment from P1 to P2 as an opaque core quad with a one pixel fringe quad on either
+// side that fades to transparent, the same geometry ImDrawList::AddLine produces with AA enabled. Consumes 8 vertices and 18 indices.
+inline void PrimLineAA(ImDrawList& DrawList, const ImVec2& P1, const ImVec2& P2, float half_core, float half_outer, ImU32 col, ImU32 col_trans, const ImVec2& uv) {
+    float nx = P2.x - P1.x;
+    float ny = P2.y - P1.y;
+    NormalizeOverZero(nx, ny);
+    // offsets perpendicular to the segment from the center line to the core and fringe edges
+    const float cx = ny * half_core,  cy = -nx * half_core;
+    const float fx = ny * half_outer, fy = -nx * half_outer;
+    ImDrawVert* v = DrawList._VtxWritePtr;
+    v[0].pos.x = P1.x + fx; v[0].pos.y = P1.y + fy; v[0].col = col_trans;
+    v[1].pos.x = P1.x + cx; v[1].pos.y = P1.y + cy; v[1].col = col;
+    v[2].pos.x = P1.x - cx; v[2].pos.y = P1.y - cy; v[2].col = col;
+    v[3].pos.x = P1.x - fx; v[3].pos.y = P1.y - fy; v[3].col = col_trans;
+    v[4].pos.x = P2.x + fx; v[4].pos.y = P2.y + fy; v[4].col = col_trans;
+    v[5].pos.x = P2.x + cx; v[5].pos.y = P2.y + cy; v[5].col = col;
+    v[6].pos.x = P2.x - cx; v[6].pos.y = P2.y - cy; v[6].col = col;
+    v[7].pos.x = P2.x - fx; v[7].pos.y = P2.y - fy; v[7].col = col_trans;
+    for (int i = 0; i < 8; ++i)
+        v[i].uv = uv;
+    DrawList._VtxWritePtr += 8;
+    // three quads across the segment: outer fringe, core, outer fringe
+    const unsigned int i0 = DrawList._VtxCurrentIdx;
+    ImDrawIdx* idx = DrawList._IdxWritePtr;
+    for (unsigned int q = 0; q < 3; ++q) {
+        idx[0] = (ImDrawIdx)(i0 + q);     idx[1] = (ImDrawIdx)(i0 + q + 1); idx[2] = (ImDrawIdx)(i0 + q + 5);
+        idx[3] = (ImDrawIdx)(i0 + q);     idx[4] = (ImDrawIdx)(i0 + q + 5); idx[5] = (ImDrawIdx)(i0 + q + 4);
+        idx += 6;
+    }
+    DrawList._IdxWritePtr += 18;
+    DrawList._VtxCurrentIdx += 8;
+}
+
+// Renderers with CheckFinite set skip segments that touch a non-finite point, leaving a gap in the line.
+
+template <typename TGetter, typename TTransformer, bool CheckFinite>
+struct LineRenderer {
+    inline LineRenderer(TGetter getter, TTransformer transformer, ImU32 col, float weight) :
+        Getter(getter),
+        Transformer(transformer)
+    {
+        Prims = Getter.Count - 1;
+        Col = col;
+        Weight = weight;
+        P1 = Transformer(Getter(0));
+        Finite1 = !CheckFinite || IsFinitePixel(P1);
+    }
+    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
+        ImPlotContext& gp = *GImPlot;
+        ImVec2 P2 = Transformer(Getter(prim + 1));
+        if (CheckFinite) {
+            const bool finite2 = IsFinitePixel(P2);
+            if (!(Finite1 && finite2)) {
+                P1 = P2;
+                Finite1 = finite2;
+                return false;
+            }
+        }
+        if (!gp.BB_Plot.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+            P1 = P2;
+            return false;
+        }
+        PrimLine(DrawList, P1, P2, Weight * 0.5f, Col, uv);
+        P1 = P2;
+        return true;
+    }
+    TGetter Getter;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col;
+    float Weight;
+    ImVec2 P1;
+    bool Finite1;
+    static const int IdxConsumed = 6;
+    static const int VtxConsumed = 4;
+};
+
+// Anti-aliased version of LineRenderer (see PrimLineAA).
+template <typename TGetter, typename TTransformer, bool CheckFinite>
+struct LineRendererAA {
+    inline LineRendererAA(TGetter getter, TTransformer transformer, ImU32 col, float weight) :
+        Getter(getter),
+        Transformer(transformer)
+    {
+        Prims = Getter.Count - 1;
+        Col = col;
+        ColTrans = col & ~IM_COL32_A_MASK;
+        HalfCore = weight > 1 ? (weight - 1) * 0.5f : 0;
+        HalfOuter = HalfCore + 1;
+        P1 = Transformer(Getter(0));
+        Finite1 = !CheckFinite || IsFinitePixel(P1);
+    }
+    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
+        ImPlotContext& gp = *GImPlot;
+        ImVec2 P2 = Transformer(Getter(prim + 1));
+        if (CheckFinite) {
+            const bool finite2 = IsFinitePixel(P2);
+            if (!(Finite1 && finite2)) {
+                P1 = P2;
+                Finite1 = finite2;
+                return false;
+            }
+        }
+        if (!gp.BB_Plot.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+            P1 = P2;
+            return false;
+        }
+        PrimLineAA(DrawList, P1, P2, HalfCore, HalfOuter, Col, ColTrans, uv);
+        P1 = P2;
+        return true;
+    }
+    TGetter Getter;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col;
+    ImU32 ColTrans;
+    float HalfCore;
+    float HalfOuter;
+    ImVec2 P1;
+    bool Finite1;
+    static const int IdxConsumed = 18;
+    static const int VtxConsumed = 8;
+};
+
+// Line renderer that simplifies the polyline in screen space as it goes (see ImPlotStyle::LineSimplify). Points are
+// merged into a running segment from the last emitted vertex (the anchor) for as long as they stay within Tol pixels
+// of its direction and don't backtrack, so the output is proportional to the on-screen path length rather than to the
+// number of points. Works for arbitrary (non-monotonic) paths. Non-finite points always break the line.
+template <typename TGetter, typename TTransformer, bool AntiAliased>
+struct LineSimplifier {
+    inline LineSimplifier(TGetter getter, TTransformer transformer, ImU32 col, float weight, float tol) :
+        Getter(getter),
+        Transformer(transformer)
+    {
+        Prims = Getter.Count; // one extra primitive to flush the last pending segment
+        Col = col;
+        ColTrans = col & ~IM_COL32_A_MASK;
+        HalfWeight = weight * 0.5f;
+        HalfCore = weight > 1 ? (weight - 1) * 0.5f : 0;
+        HalfOuter = HalfCore + 1;
+        Tol = tol;
+        Anchor = Transformer(Getter(0));
+        HasAnchor = IsFinitePixel(Anchor);
+        Pending = HasDir = false;
+    }
+    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
+        if (prim + 1 == Prims)
+            return Pending && Emit(DrawList, uv);
+        const ImVec2 P = Transformer(Getter(prim + 1));
+        if (!IsFinitePixel(P)) {
+            const bool emitted = Pending && Emit(DrawList, uv);
+            HasAnchor = Pending = HasDir = false;
+            return emitted;
+        }
+        if (!HasAnchor) {
+            Anchor = P;
+            HasAnchor = true;
+            return false;
+        }
+        const float dx = P.x - Anchor.x;
+        const float dy = P.y - Anchor.y;
+        if (!HasDir) {
+            // the direction of the running segment is set by the first point that leaves the tolerance around the anchor
+            const float d2 = dx * dx + dy * dy;
+            End = P;
+            Pending = true;
+            if (d2 >= Tol * Tol) {
+                const float inv = 1.0f / ImSqrt(d2);
+                Dir = ImVec2(dx * inv, dy * inv);
+                Along = d2 * inv;
+                HasDir = true;
+            }
+            return false;
+        }
+        const float along = dx * Dir.x + dy * Dir.y;
+        const float perp  = dx * Dir.y - dy * Dir.x;
+        if (perp <= Tol && perp >= -Tol && along >= Along - Tol) {
+            End = P;
+            Along = ImMax(Along, along);
+            return false;
+        }
+        // P leaves the running segment: emit it and start the next one from its end
+        const bool emitted = Emit(DrawList, uv);
+        End = P;
+        Pending = true;
+        const float ex = P.x - Anchor.x;
+        const float ey = P.y - Anchor.y;
+        const float d2 = ex * ex + ey * ey;
+        HasDir = d2 >= Tol * Tol;
+        if (HasDir) {
+            const float inv = 1.0f / ImSqrt(d2);
+            Dir = ImVec2(ex * inv, ey * inv);
+            Along = d2 * inv;
+        }
+        return emitted;
+    }
+    // Writes the segment from Anchor to End (if visible) and moves the anchor to End.
+    inline bool Emit(ImDrawList& DrawList, const ImVec2& uv) {
+        ImPlotContext& gp = *GImPlot;
+        const ImVec2 P1 = Anchor;
+        Anchor = End;
+        Pending = HasDir = false;
+        if (!gp.BB_Plot.Overlaps(ImRect(ImMin(P1, End), ImMax(P1, End))))
+            return false;
+        if (AntiAliased)
+            PrimLineAA(DrawList, P1, End, HalfCore, HalfOuter, Col, ColTrans, uv);
+        else
+            PrimLine(DrawList, P1, End, HalfWeight, Col, uv);
+        return true;
+    }
+    TGetter Getter;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col;
+    ImU32 ColTrans;
+    float HalfWeight;
+    float HalfCore;
+    float HalfOuter;
+    float Tol;
+    ImVec2 Anchor;    // last emitted vertex
+    ImVec2 End;       // last point merged into the running segment
+    ImVec2 Dir;       // unit direction of the running segment
+    float  Along;     // furthest distance reached along Dir
+    bool   HasAnchor;
+    bool   HasDir;
+    bool   Pending;   // a segment from Anchor to End is waiting to be emitted
+    static const int IdxConsumed = AntiAliased ? 18 : 6;
+    static const int VtxConsumed = AntiAliased ? 8 : 4;
+};
+
+template <typename TGetter1, typename TGetter2, typename TTransformer, bool CheckFinite>
+struct ShadedRenderer {
+    ShadedRenderer(TGetter1 getter1, TGetter2 getter2, TTransformer transformer, ImU32 col) :
+        Getter1(getter1),
+        Getter2(getter2),
+        Transformer(transformer),
+        Col(col)
+    {
+        Prims = ImMin(Getter1.Count, Getter2.Count) - 1;
+        P11 = Transformer(Getter1(0));
+        P12 = Transformer(Getter2(0));
+        Finite1 = !CheckFinite || (IsFinitePixel(P11) && IsFinitePixel(P12));
+    }
+
+    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
+        // TODO: Culling
+        ImVec2 P21 = Transformer(Getter1(prim+1));
+        ImVec2 P22 = Transformer(Getter2(prim+1));
+        if (CheckFinite) {
+            const bool finite2 = IsFinitePixel(P21) && IsFinitePixel(P22);
+            if (!(Finite1 && finite2)) {
+                P11 = P21;
+                P12 = P22;
+                Finite1 = finite2;
+                return false;
+            }
+        }
+        const int intersect = (P11.y > P12.y && P22.y > P21.y) || (P12.y > P11.y && P21.y > P22.y);
+        ImVec2 intersection = Intersection(P11,P21,P12,P22);
+        DrawList._VtxWritePtr[0].pos = P11;
+        DrawList._VtxWritePtr[0].uv  = uv;
+        DrawList._VtxWritePtr[0].col = Col;
+        DrawList._VtxWritePtr[1].pos = P21;
+        DrawList._VtxWritePtr[1].uv  = uv;
+        DrawList._VtxWritePtr[1].col = Col;
+        DrawList._VtxWritePtr[2].pos = intersection;
+        DrawList._VtxWritePtr[2].uv  = uv;
+        DrawList._VtxWritePtr[2].col = Col;
+        DrawList._VtxWritePtr[3].pos = P12;
+        DrawList._VtxWritePtr[3].uv  = uv;
+        DrawList._VtxWritePtr[3].col = Col;
+        DrawList._VtxWritePtr[4].pos = P22;
+        DrawList._VtxWritePtr[4].uv  = uv;
+        DrawList._VtxWritePtr[4].col = Col;
+        DrawList._VtxWritePtr += 5;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1 + intersect);
+        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3 - intersect);
+        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 4);
+        DrawList._IdxWritePtr += 6;
+        DrawList._VtxCurrentIdx += 5;
+        P11 = P21;
+        P12 = P22;
+        return true;
+    }
+    TGetter1 Getter1;
+    TGetter2 Getter2;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col;
+    ImVec2 P11, P12;
+    bool Finite1;
+    static const int IdxConsumed = 6;
+    static const int VtxConsumed = 5;
+};
+
+template <typename TGetter, typename TTransformer>
+struct RectRenderer {
+    inline RectRenderer(TGetter getter, TTransformer transformer, ImU32 col) :
+        Getter(getter),
+        Transformer(transformer)
+    {
+        Prims = Getter.Count / 2;
+        Col = col;
+    }
+    inline bool operator()(ImDrawList& DrawList, ImVec2 uv, int prim) {
+        // TODO: Culling
+        ImVec2 P1 = Transformer(Getter(2*prim));
+        ImVec2 P2 = Transformer(Getter(2*prim+1));
+        DrawList._VtxWritePtr[0].pos   = P1;
+        DrawList._VtxWritePtr[0].uv    = uv;
+        DrawList._VtxWritePtr[0].col   = Col;
+        DrawList._VtxWritePtr[1].pos.x = P1.x;
+        DrawList._VtxWritePtr[1].pos.y = P2.y;
+        DrawList._VtxWritePtr[1].uv    = uv;
+        DrawList._VtxWritePtr[1].col   = Col;
+        DrawList._VtxWritePtr[2].pos   = P2;
+        DrawList._VtxWritePtr[2].uv    = uv;
+        DrawList._VtxWritePtr[2].col   = Col;
+        DrawList._VtxWritePtr[3].pos.x = P2.x;
+        DrawList._VtxWritePtr[3].pos.y = P1.y;
+        DrawList._VtxWritePtr[3].uv    = uv;
+        DrawList._VtxWritePtr[3].col   = Col;
+        DrawList._VtxWritePtr += 4;
+        DrawList._IdxWritePtr[0] = (ImDrawIdx)(DrawList._VtxCurrentIdx);
+        DrawList._IdxWritePtr[1] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[2] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr[3] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 1);
+        DrawList._IdxWritePtr[4] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 2);
+        DrawList._IdxWritePtr[5] = (ImDrawIdx)(DrawList._VtxCurrentIdx + 3);
+        DrawList._IdxWritePtr   += 6;
+        DrawList._VtxCurrentIdx += 4;
+        return true;
+    }
+    TGetter Getter;
+    TTransformer Transformer;
+    int Prims;
+    ImU32 Col;
+    static const int IdxConsumed = 6;
+    static const int VtxConsumed = 4;
+};
+
+// Stupid way of calculating maximum index size of ImDrawIdx without integer overflow issues
+template <typename T>
+struct MaxIdx;
+template <> struct MaxIdx<unsigned short> { static const unsigned int Value = 65535; };
+template <> struct MaxIdx<unsigned int>   { static const unsigned int Value = 4294967295u; };
+
+/// Renders primitive shapes in bulk as efficiently as possible.
+template <typename Renderer>
+inline void RenderPrimitives(Renderer renderer, ImDrawList& DrawList) {
+    unsigned int prims        = renderer.Prims;
+    unsigned int prims_culled = 0;
+    unsigned int idx          = 0;
+    // with 32-bit indices the whole item is reserved at once. with 16-bit indices a draw command addresses at most 64k vertices, so
+    // each reservation fills the rest of the current command or a whole new one. when the backend handles ImGuiBackendFlags_RendererHasVtxOffset,
+    // PrimReserve starts the next command at a vertex offset so indices stay 16-bit, otherwise indices past that point would wrap around.
+    const unsigned int max_cnt = MaxIdx<ImDrawIdx>::Value / Renderer::VtxConsumed;
+    const bool vtx_offset = sizeof(ImDrawIdx) != 2 || ImHasFlag(DrawList.Flags, ImDrawListFlags_AllowVtxOffset);
+    const ImVec2 uv = DrawList._Data->TexUvWhitePixel;
+    while (prims) {
+        // find how many can be reserved up to end of current draw command's limit
+        const unsigned int vtx_left = DrawList._VtxCurrentIdx < MaxIdx<ImDrawIdx>::Value ? MaxIdx<ImDrawIdx>::Value - DrawList._VtxCurrentIdx : 0;
+        unsigned int cnt = ImMin(prims, vtx_left / Renderer::VtxConsumed);
+        // make sure at least this many elements can be rendered to avoid situations where at the end of buffer this slow path is not taken all the time
+        if (cnt >= ImMin(64u, prims)) {
+            if (prims_culled >= cnt)
+                prims_culled -= cnt; // reuse previous reservation
+            else {
+                DrawList.PrimReserve((cnt - prims_culled) * Renderer::IdxConsumed, (cnt - prims_culled) * Renderer::VtxConsumed); // add more elements to previous reservation
+                prims_culled = 0;
+            }
+        }
+        else
+        {
+            if (prims_culled > 0) {
+                DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
+                prims_culled = 0;
+            }
+            if (vtx_offset || cnt == 0) {
+                IM_ASSERT_USER_ERROR(vtx_offset, "Too many vertices in ImDrawList using 16-bit indices. Enable ImGuiBackendFlags_RendererHasVtxOffset or define ImDrawIdx as unsigned int (see GetItemDrawCmdCount).");
+                cnt = ImMin(prims, max_cnt); // reserve new draw command
+            }
+            DrawList.PrimReserve(cnt * Renderer::IdxConsumed, cnt * Renderer::VtxConsumed);
+        }
+        prims -= cnt;
+        for (unsigned int ie = idx + cnt; idx != ie; ++idx) {
+            if (!renderer(DrawList, uv, idx))
+                prims_culled++;
+        }
+    }
+    if (prims_culled > 0)
+        DrawList.PrimUnreserve(prims_culled * Renderer::IdxConsumed, prims_culled * Renderer::VtxConsumed);
+}
+
+template <typename Getter1, typename Getter2, typename Transformer>
+inline void RenderShaded(Getter1 getter1, Getter2 getter2, Transformer transformer, ImDrawList& DrawList, ImU32 col) {
+    if (ItemNeedsFiniteChecks())
+        RenderPrimitives(ShadedRenderer<Getter1,Getter2,Transformer,true>(getter1, getter2, transformer, col), DrawList);
+    else
+        RenderPrimitives(ShadedRenderer<Getter1,Getter2,Transformer,false>(getter1, getter2, transformer, col), DrawList);
+}
+
+template <typename Getter, typename Transformer>
+inline void RenderLineStrip(Getter getter, Transformer transformer, ImDrawList& DrawList, float line_weight, ImU32 col) {
+    ImPlotContext& gp = *GImPlot;
+    const bool check = ItemNeedsFiniteChecks();
+    if (gp.Style.LineSimplify > 0) {
+        if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased))
+            RenderPrimitives(LineSimplifier<Getter,Transformer,true>(getter, transformer, col, line_weight, gp.Style.LineSimplify), DrawList);
+        else
+            RenderPrimitives(LineSimplifier<Getter,Transformer,false>(getter, transformer, col, line_weight, gp.Style.LineSimplify), DrawList);
+    }
+    else if (ImHasFlag(gp.CurrentPlot->Flags, ImPlotFlags_AntiAliased)) {
+        if (check)
+            RenderPrimitives(LineRendererAA<Getter,Transformer,true>(getter, transformer, col, line_weight), DrawList);
+        else
+            RenderPrimitives(LineRendererAA<Getter,Transformer,false>(getter, transformer, col, line_weight), DrawList);
+    }
+    else {
+        if (check)
+            RenderPrimitives(LineRenderer<Getter,Transformer,true>(getter, transformer, col, line_weight), DrawList);
+        else
+            RenderPrimitives(LineRenderer<Getter,Transformer,false>(getter, transformer, col, line_weight), DrawList);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// MARKER RENDERERS
+//-----------------------------------------------------------------------------
+
+inline void TransformMarker(ImVec2* points, int n, const ImVec2& c, float s) {
+    for (int i = 0; i < n; ++i) {
+        points[i].x = c.x + points[i].x * s;
+        points[i].y = c.y + points[i].y * s;
+    }
+}
+
+inline void MarkerGeneral(ImDrawList& DrawList, ImVec2* points, int n, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    TransformMarker(points, n, c, s);
+    if (fill)
+        DrawList.AddConvexPolyFilled(points, n, col_fill);
+    if (outline && !(fill && col_outline == col_fill)) {
+        for (int i = 0; i < n; ++i)
+            DrawList.AddLine(points[i], points[(i+1)%n], col_outline, weight);
+    }
+}
+
+inline void MarkerCircle(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    ImVec2 marker[10] = {ImVec2(1.0f, 0.0f),
+                         ImVec2(0.809017f, 0.58778524f),
+                         ImVec2(0.30901697f, 0.95105654f),
+                         ImVec2(-0.30901703f, 0.9510565f),
+                         ImVec2(-0.80901706f, 0.5877852f),
+                         ImVec2(-1.0f, 0.0f),
+                         ImVec2(-0.80901694f, -0.58778536f),
+                         ImVec2(-0.3090171f, -0.9510565f),
+                         ImVec2(0.30901712f, -0.9510565f),
+                         ImVec2(0.80901694f, -0.5877853f)};
+    MarkerGeneral(DrawList, marker, 10, c, s, outline, col_outline, fill, col_fill, weight);
+}
+
+inline void MarkerDiamond(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    ImVec2 marker[4] = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
+    MarkerGeneral(DrawList, marker, 4, c, s, outline, col_outline, fill, col_fill, weight);
+}
+
+inline void MarkerSquare(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    ImVec2 marker[4] = {ImVec2(IMPLOT_SQRT_1_2,IMPLOT_SQRT_1_2),ImVec2(IMPLOT_SQRT_1_2,-IMPLOT_SQRT_1_2),ImVec2(-IMPLOT_SQRT_1_2,-IMPLOT_SQRT_1_2),ImVec2(-IMPLOT_SQRT_1_2,IMPLOT_SQRT_1_2)};
+    MarkerGeneral(DrawList, marker, 4, c, s, outline, col_outline, fill, col_fill, weight);
+}
+
+inline void MarkerUp(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    ImVec2 marker[3] = {ImVec2(IMPLOT_SQRT_3_2,0.5f),ImVec2(0,-1),ImVec2(-IMPLOT_SQRT_3_2,0.5f)};
+    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+}
+
+inline void MarkerDown(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    ImVec2 marker[3] = {ImVec2(IMPLOT_SQRT_3_2,-0.5f),ImVec2(0,1),ImVec2(-IMPLOT_SQRT_3_2,-0.5f)};
+    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+}
+
+inline void MarkerLeft(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    ImVec2 marker[3] = {ImVec2(-1,0), ImVec2(0.5, IMPLOT_SQRT_3_2), ImVec2(0.5, -IMPLOT_SQRT_3_2)};
+    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+}
+
+inline void MarkerRight(ImDrawList& DrawList, const ImVec2& c, float s, bool outline, ImU32 col_outline, bool fill, ImU32 col_fill, float weight) {
+    ImVec2 marker[3] = {ImVec2(1,0), ImVec2(-0.5, IMPLOT_SQRT_3_2), ImVec2(-0.5, -IMPLOT_SQRT_3_2)};
+    MarkerGeneral(DrawList, marker, 3, c, s, outline, col_outline, fill, col_fill, weight);
+}
+
+inline void MarkerAsterisk(ImDrawList& DrawList, const ImVec2& c, float s, bool /*outline*/, ImU32 col_outline, bool /*fill*/, ImU32 /*col_fill*/, float weight) {
+    ImVec2 marker[6] = {ImVec2(IMPLOT_SQRT_3_2, 0.5f), ImVec2(0, -1), ImVec2(-IMPLOT_SQRT_3_2, 0.5f), ImVec2(IMPLOT_SQRT_3_2, -0.5f), ImVec2(0, 1),  ImVec2(-IMPLOT_SQRT_3_2, -0.5f)};
+    TransformMarker(marker, 6, c, s);
+    DrawList.AddLine(marker[0], marker[5], col_outline, weight);
+    DrawList.AddLine(marker[1], marker[4], col_outline, weight);
+    DrawList.AddLine(marker[2], marker[3], col_outline, weight);
+}
+
+inline void MarkerPlus(ImDrawList& DrawList, const ImVec2& c, float s, bool /*outline*/, ImU32 col_outline, bool /*fill*/, ImU32 /*col_fill*/, float weight) {
+    ImVec2 marker[4] = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
+    TransformMarker(marker, 4, c, s);
+    DrawList.AddLine(marker[0], marker[2], col_outline, weight);
+    DrawList.AddLine(marker[1], marker[3], col_outline, weight);
+}
+
+inline void MarkerCross(ImDrawList& DrawList, const ImVec2& c, float s, bool /*outline*/, ImU32 col_outline, bool /*fill*/, ImU32 /*col_fill*/, float weight) {
+    ImVec2 marker[4] = {ImVec2(IMPLOT_SQRT_1_2,IMPLOT_SQRT_1_2),ImVec2(IMPLOT_SQRT_1_2,-IMPLOT_SQRT_1_2),ImVec2(-IMPLOT_SQRT_1_2,-IMPLOT_SQRT_1_2),ImVec2(-IMPLOT_SQRT_1_2,IMPLOT_SQRT_1_2)};
+    TransformMarker(marker, 4, c, s);
+    DrawList.AddLine(marker[0], marker[2], col_outline, weight);
+    DrawList.AddLine(marker[1], marker[3], col_outline, weight);
+}
+
+template <typename Transformer, typename Getter>
+inline void RenderMarkers(Getter getter, Transformer transformer, ImDrawList& DrawList, bool rend_mk_line, ImU32 col_mk_line, bool rend_mk_fill, ImU32 col_mk_fill) {
+    ImPlotContext& gp = *GImPlot;
+    for (int i = 0; i < getter.Count; ++i) {
+        ImVec2 c = transformer(getter(i));
+        if (gp.BB_Plot.Contains(c)) {
+            // TODO: Optimize the loop and if statements, this is atrocious
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Circle))
+                MarkerCircle(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Square))
+                MarkerSquare(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Diamond))
+                MarkerDiamond(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Up))
+                MarkerUp(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Down))
+                MarkerDown(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Left))
+                MarkerLeft(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Right))
+                MarkerRight(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Cross))
+                MarkerCross(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Plus))
+                MarkerPlus(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+            if (ImHasFlag(gp.Style.Marker, ImPlotMarker_Asterisk))
+                MarkerAsterisk(DrawList, c, gp.Style.MarkerSize, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill, gp.Style.MarkerWeight);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// ITEM FITTING AND CULLING
+//-----------------------------------------------------------------------------
+
+// Returns true if the points of an item need to be visited, either to fit the plot or to rescan the
+// cached data bounds of an item whose data version changed (see SetNextItemDataVersion).
+inline bool BeginItemFit(ImPlotItem* item) {
+    ImPlotContext& gp = *GImPlot;
+    gp.ItemBounds.X = gp.ItemBounds.Y = ImPlotRange(HUGE_VAL, -HUGE_VAL);
+    return gp.FitThisFrame || (gp.ItemDataVersion != -1 && gp.ItemDataVersion != item->DataVersion);
+}
+
+// Fits the plot to a point (if fitting this frame) and accumulates it into the item's data bounds.
+inline void FitItemPoint(const ImPlotPoint& p) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.FitThisFrame)
+        FitPoint(p);
+    if (!NanOrInf(p.x)) {
+        gp.ItemBounds.X.Min = p.x < gp.ItemBounds.X.Min ? p.x : gp.ItemBounds.X.Min;
+        gp.ItemBounds.X.Max = p.x > gp.ItemBounds.X.Max ? p.x : gp.ItemBounds.X.Max;
+    }
+    if (!NanOrInf(p.y)) {
+        gp.ItemBounds.Y.Min = p.y < gp.ItemBounds.Y.Min ? p.y : gp.ItemBounds.Y.Min;
+        gp.ItemBounds.Y.Max = p.y > gp.ItemBounds.Y.Max ? p.y : gp.ItemBounds.Y.Max;
+    }
+}
+
+// Expands plot space bounds on the current axes by the pixels an item draws beyond its data points (line weight, markers),
+// so that items just outside of the axes limits whose lines or markers still overlap the plot are not culled.
+inline ImPlotLimits PadItemBounds(const ImPlotItem* item, const ImPlotLimits& bounds) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotState& plot = *gp.CurrentPlot;
+    const int y_axis = plot.CurrentYAxis;
+    double pad = item->Highlight ? gp.Style.LineWeight * 2 : gp.Style.LineWeight;
+    if (gp.Style.Marker != ImPlotMarker_None)
+        pad = ImMax(pad, (double)(gp.Style.MarkerSize + gp.Style.MarkerWeight));
+    if (pad <= 0)
+        return bounds;
+    ImPlotLimits padded = bounds;
+    if (ImHasFlag(plot.XAxis.Flags, ImPlotAxisFlags_LogScale)) {
+        const double f = ImPow(10.0, pad * gp.LogDenX / gp.BB_Plot.GetWidth());
+        padded.X.Min /= f;
+        padded.X.Max *= f;
+    }
+    else {
+        const double d = pad / fabs(gp.Mx);
+        padded.X.Min -= d;
+        padded.X.Max += d;
+    }
+    if (ImHasFlag(plot.YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale)) {
+        const double f = ImPow(10.0, pad * gp.LogDenY[y_axis] / gp.BB_Plot.GetHeight());
+        padded.Y.Min /= f;
+        padded.Y.Max *= f;
+    }
+    else {
+        const double d = pad / fabs(gp.My[y_axis]);
+        padded.Y.Min -= d;
+        padded.Y.Max += d;
+    }
+    return padded;
+}
+
+// Caches the bounds accumulated since BeginItemFit for versioned items. Returns false if the item is
+// versioned and its data bounds, padded by its pixel extent, are entirely outside of the axes limits, i.e. it can be skipped.
+inline bool EndItemFit(ImPlotItem* item) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.ItemDataVersion == -1)
+        return true;
+    if (gp.FitThisFrame || gp.ItemDataVersion != item->DataVersion) {
+        item->DataBounds  = gp.ItemBounds;
+        item->DataVersion = gp.ItemDataVersion;
+    }
+    return IsInView(PadItemBounds(item, item->DataBounds));
+}
+
+// Computes the index range [*first, *first + *count) of uniformly spaced samples (x = x0 + idx * dx) that lie within
+// the current X axis range, including one sample on either side so that lines extend to the plot edges. O(1).
+template <typename I>
+inline void ClipUniformRange(double x0, double dx, I size, I* first, I* count) {
+    ImPlotContext& gp = *GImPlot;
+    if (size == 0 || dx == 0 || NanOrInf(x0) || NanOrInf(dx))
+        return;
+    double i0 = (gp.CurrentPlot->XAxis.Range.Min - x0) / dx;
+    double i1 = (gp.CurrentPlot->XAxis.Range.Max - x0) / dx;
+    if (i0 > i1)
+        ImSwap(i0, i1);
+    i0 = ImClamp(floor(i0) - 1, 0.0, (double)size);
+    i1 = ImClamp(ceil(i1) + 1, -1.0, (double)(size - 1));
+    *first = (I)i0;
+    *count = i1 >= i0 ? (I)i1 - *first + 1 : 0;
+}
+
+// Restricts a getter to the samples within the current X axis range. Only getters with implicit, uniformly spaced X
+// values can do this without scanning, all others are left untouched. Must be called after the item has been fit.
+// Getters opt in with an overload of their own, which is found by argument dependent lookup.
+template <typename Getter>
+inline void ClipGetterToView(Getter&) { }
+
+//-----------------------------------------------------------------------------
+// PLOT LINES / MARKERS
+//-----------------------------------------------------------------------------
+
+// Renders markers at the points of an item with the current marker style, if any. Must be called within PushPlotClipRect/PopPlotClipRect.
+template <typename Getter>
+inline void RenderItemMarkers(ImPlotItem* item, const Getter& getter) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.Style.Marker == ImPlotMarker_None)
+        return;
+    ImDrawList& DrawList = *ImGui::GetWindowDrawList();
+    ImPlotState* plot = gp.CurrentPlot;
+    const int y_axis = plot->CurrentYAxis;
+    const bool rend_mk_line = WillMarkerOutlineRender();
+    const bool rend_mk_fill = WillMarkerFillRender();
+    const ImU32 col_mk_line = ImGui::GetColorU32(GetMarkerOutlineColor(item));
+    const ImU32 col_mk_fill = ImGui::GetColorU32(GetMarkerFillColor(item));
+    if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+        RenderMarkers(getter, TransformerLogLog(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
+    else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
+        RenderMarkers(getter, TransformerLogLin(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
+    else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+        RenderMarkers(getter, TransformerLinLog(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
+    else if (UseFloatTransform<Getter>(y_axis))
+        RenderMarkers(getter, TransformerLinLinF(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
+    else
+        RenderMarkers(getter, TransformerLinLin(y_axis), DrawList, rend_mk_line, col_mk_line, rend_mk_fill, col_mk_fill);
+}
+
+// Plots an item that was already registered this frame with RegisterOrGetItem (e.g. to use its cached state first).
+template <typename Getter>
+inline void PlotItemEx(ImPlotItem* item, Getter getter)
+{
+    ImPlotContext& gp = *GImPlot;
+    if (!item->Show)
+        return;
+    TryRecolorItem(item, ImPlotCol_Line);
+
+    // find data extents
+    if (BeginItemFit(item)) {
+        for (int i = 0; i < getter.Count; ++i) {
+            ImPlotPoint p = getter(i);
+            FitItemPoint(p);
+        }
+    }
+    if (!EndItemFit(item))
+        return;
+    ClipGetterToView(getter);
+
+    ImDrawList& DrawList = *ImGui::GetWindowDrawList();
+    ImPlotState* plot = gp.CurrentPlot;
+    const int y_axis = plot->CurrentYAxis;
+
+    PushPlotClipRect();
+    // render line
+    if (getter.Count > 1 && WillLineRender()) {
+        ImU32 col_line = ImGui::GetColorU32(GetLineColor(item));
+        const float line_weight = item->Highlight ? gp.Style.LineWeight * 2 : gp.Style.LineWeight;
+        if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+            RenderLineStrip(getter, TransformerLogLog(y_axis), DrawList, line_weight, col_line);
+        else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
+            RenderLineStrip(getter, TransformerLogLin(y_axis), DrawList, line_weight, col_line);
+        else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+            RenderLineStrip(getter, TransformerLinLog(y_axis), DrawList, line_weight, col_line);
+        else if (UseFloatTransform<Getter>(y_axis))
+            RenderLineStrip(getter, TransformerLinLinF(y_axis), DrawList, line_weight, col_line);
+        else
+            RenderLineStrip(getter, TransformerLinLin(y_axis), DrawList, line_weight, col_line);
+    }
+    // render markers
+    RenderItemMarkers(item, getter);
+    PopPlotClipRect();
+}
+
+template <typename ItemId, typename Getter>
+inline void PlotEx(const ItemId& item_id, Getter getter) {
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != NULL, "PlotEx() needs to be called between BeginPlot() and EndPlot()!");
+    PlotItemEx(RegisterOrGetItem(item_id), getter);
+}
+
+inline int PushScatterStyle() {
+    int vars = 1;
+    PushStyleVar(ImPlotStyleVar_LineWeight, 0);
+    if (GetStyle().Marker == ImPlotMarker_None) {
+        PushStyleVar(ImPlotStyleVar_Marker, ImPlotMarker_Circle);
+        vars++;
+    }
+    return vars;
+}
+
+// Plots a standard 2D line plot from a user getter.
+template <typename Getter>
+inline void PlotLine(const char* label_id, const Getter& getter) {
+    PlotEx(label_id, getter);
+}
+
+// Plots a standard 2D scatter plot from a user getter. Default marker is ImPlotMarker_Circle.
+template <typename Getter>
+inline void PlotScatter(const char* label_id, const Getter& getter) {
+    int vars = PushScatterStyle();
+    PlotEx(label_id, getter);
+    PopStyleVar(vars);
+}
+
+//-----------------------------------------------------------------------------
+// PLOT SHADED
+//-----------------------------------------------------------------------------
+
+template <typename ItemId, typename Getter1, typename Getter2>
+inline void PlotShadedEx(const ItemId& item_id, Getter1 getter1, Getter2 getter2) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotShaded() needs to be called between BeginPlot() and EndPlot()!");
+
+    ImPlotItem* item = RegisterOrGetItem(item_id);
+    if (!item->Show)
+        return;
+    TryRecolorItem(item, ImPlotCol_Fill);
+
+    if (!WillFillRender())
+        return;
+
+    // find data extents
+    if (BeginItemFit(item)) {
+        for (int i = 0; i < ImMin(getter1.Count, getter2.Count); ++i) {
+            ImPlotPoint p1 = getter1(i);
+            ImPlotPoint p2 = getter2(i);
+            FitItemPoint(p1);
+            FitItemPoint(p2);
+        }
+    }
+    if (!EndItemFit(item))
+        return;
+    ClipGetterToView(getter1);
+    ClipGetterToView(getter2);
+
+    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
+    ImPlotState* plot = gp.CurrentPlot;
+    const int y_axis = plot->CurrentYAxis;
+
+    ImU32 col = ImGui::GetColorU32(GetItemFillColor(item));
+
+    PushPlotClipRect();
+    if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+        RenderShaded(getter1, getter2, TransformerLogLog(y_axis), DrawList, col);
+    else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
+        RenderShaded(getter1, getter2, TransformerLogLin(y_axis), DrawList, col);
+    else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+        RenderShaded(getter1, getter2, TransformerLinLog(y_axis), DrawList, col);
+    else if (UseFloatTransform<Getter1>(y_axis) && UseFloatTransform<Getter2>(y_axis))
+        RenderShaded(getter1, getter2, TransformerLinLinF(y_axis), DrawList, col);
+    else
+        RenderShaded(getter1, getter2, TransformerLinLin(y_axis), DrawList, col);
+    PopPlotClipRect();
+}
+
+//-----------------------------------------------------------------------------
+// PLOT BAR V
+//-----------------------------------------------------------------------------
+
+template <typename ItemId, typename Getter, typename TWidth>
+void PlotBarsEx(const ItemId& item_id, Getter getter, TWidth width) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotBars() needs to be called between BeginPlot() and EndPlot()!");
+
+    ImPlotItem* item = RegisterOrGetItem(item_id);
+    if (!item->Show)
+        return;
+    TryRecolorItem(item, ImPlotCol_Fill);
+
+    const TWidth half_width = width / 2;
+    // find data extents
+    if (BeginItemFit(item)) {
+        for (int i = 0; i < getter.Count; ++i) {
+            ImPlotPoint p = getter(i);
+            FitItemPoint(ImPlotPoint(p.x - half_width, p.y));
+            FitItemPoint(ImPlotPoint(p.x + half_width, 0));
+        }
+    }
+    if (!EndItemFit(item))
+        return;
+
+    ImU32 col_line = ImGui::GetColorU32(GetLineColor(item));
+    ImU32 col_fill = ImGui::GetColorU32(GetItemFillColor(item));
+    const bool rend_fill = WillFillRender();
+    bool rend_line       = WillLineRender();
+    if (rend_fill && col_line == col_fill)
+        rend_line = false;
+
+    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
+    PushPlotClipRect();
+    for (int i = 0; i < getter.Count; ++i) {
+        ImPlotPoint p = getter(i);
+        if (p.y == 0)
+            continue;
+        ImVec2 a = PlotToPixels(p.x - half_width, p.y);
+        ImVec2 b = PlotToPixels(p.x + half_width, 0);
+        if (rend_fill)
+            DrawList.AddRectFilled(a, b, col_fill);
+        if (rend_line)
+            DrawList.AddRect(a, b, col_line, 0, ImDrawCornerFlags_All, gp.Style.LineWeight);
+    }
+    PopPlotClipRect();
+}
+
+//-----------------------------------------------------------------------------
+// PLOT BAR H
+//-----------------------------------------------------------------------------
+
+// TODO: Migrate to RenderPrimitives
+
+template <typename ItemId, typename Getter, typename THeight>
+void PlotBarsHEx(const ItemId& item_id, Getter getter, THeight height) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotBarsH() needs to be called between BeginPlot() and EndPlot()!");
+
+    ImPlotItem* item = RegisterOrGetItem(item_id);
+    if (!item->Show)
+        return;
+    TryRecolorItem(item, ImPlotCol_Fill);
+
+    const THeight half_height = height / 2;
+    // find data extents
+    if (BeginItemFit(item)) {
+        for (int i = 0; i < getter.Count; ++i) {
+            ImPlotPoint p = getter(i);
+            FitItemPoint(ImPlotPoint(0, p.y - half_height));
+            FitItemPoint(ImPlotPoint(p.x, p.y + half_height));
+        }
+    }
+    if (!EndItemFit(item))
+        return;
+
+    ImU32 col_line = ImGui::GetColorU32(GetLineColor(item));
+    ImU32 col_fill = ImGui::GetColorU32(GetItemFillColor(item));
+    const bool rend_fill = WillFillRender();
+    bool rend_line       = WillLineRender();
+    if (rend_fill && col_line == col_fill)
+        rend_line = false;
+
+    PushPlotClipRect();
+    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
+    for (int i = 0; i < getter.Count; ++i) {
+        ImPlotPoint p = getter(i);
+        if (p.x == 0)
+            continue;
+        ImVec2 a = PlotToPixels(0, p.y - half_height);
+        ImVec2 b = PlotToPixels(p.x, p.y + half_height);
+        if (rend_fill)
+            DrawList.AddRectFilled(a, b, col_fill);
+        if (rend_line)
+            DrawList.AddRect(a, b, col_line, 0, ImDrawCornerFlags_All, gp.Style.LineWeight);
+    }
+    PopPlotClipRect();
+}
+
+//-----------------------------------------------------------------------------
+// PLOT ERROR BARS
+//-----------------------------------------------------------------------------
+
+template <typename ItemId, typename Getter>
+void PlotErrorBarsEx(const ItemId& item_id, Getter getter) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotErrorBars() needs to be called between BeginPlot() and EndPlot()!");
+
+    ImPlotItem* item = RegisterOrGetItem(item_id);
+    if (!item->Show)
+        return;
+
+    // find data extents
+    if (BeginItemFit(item)) {
+        for (int i = 0; i < getter.Count; ++i) {
+            ImPlotPointError e = getter(i);
+            FitItemPoint(ImPlotPoint(e.X , e.Y - e.Neg));
+            FitItemPoint(ImPlotPoint(e.X , e.Y + e.Pos ));
+        }
+    }
+    if (!EndItemFit(item))
+        return;
+
+    const ImU32 col = ImGui::GetColorU32(GetErrorBarColor());
+    const bool rend_whisker = gp.Style.ErrorBarSize > 0;
+    const float half_whisker = gp.Style.ErrorBarSize * 0.5f;
+
+    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
+
+    PushPlotClipRect();
+    for (int i = 0; i < getter.Count; ++i) {
+        ImPlotPointError e = getter(i);
+        ImVec2 p1 = PlotToPixels(e.X, e.Y - e.Neg);
+        ImVec2 p2 = PlotToPixels(e.X, e.Y + e.Pos);
+        DrawList.AddLine(p1,p2,col, gp.Style.ErrorBarWeight);
+        if (rend_whisker) {
+            DrawList.AddLine(p1 - ImVec2(half_whisker, 0), p1 + ImVec2(half_whisker, 0), col, gp.Style.ErrorBarWeight);
+            DrawList.AddLine(p2 - ImVec2(half_whisker, 0), p2 + ImVec2(half_whisker, 0), col, gp.Style.ErrorBarWeight);
+        }
+    }
+    PopPlotClipRect();
+}
+
+//-----------------------------------------------------------------------------
+// PLOT ERROR BARS H
+//-----------------------------------------------------------------------------
+
+template <typename ItemId, typename Getter>
+void PlotErrorBarsHEx(const ItemId& item_id, Getter getter) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotErrorBarsH() needs to be called between BeginPlot() and EndPlot()!");
+
+    ImPlotItem* item = RegisterOrGetItem(item_id);
+    if (!item->Show)
+        return;
+
+    // find data extents
+    if (BeginItemFit(item)) {
+        for (int i = 0; i < getter.Count; ++i) {
+            ImPlotPointError e = getter(i);
+            FitItemPoint(ImPlotPoint(e.X - e.Neg, e.Y));
+            FitItemPoint(ImPlotPoint(e.X + e.Pos, e.Y));
+        }
+    }
+    if (!EndItemFit(item))
+        return;
+
+    const ImU32 col = ImGui::GetColorU32(GetErrorBarColor());
+    const bool rend_whisker = gp.Style.ErrorBarSize > 0;
+    const float half_whisker = gp.Style.ErrorBarSize * 0.5f;
+
+    ImDrawList& DrawList = *ImGui::GetWindowDrawList();
+
+    PushPlotClipRect();
+    for (int i = 0; i < getter.Count; ++i) {
+        ImPlotPointError e = getter(i);
+        ImVec2 p1 = PlotToPixels(e.X - e.Neg, e.Y);
+        ImVec2 p2 = PlotToPixels(e.X + e.Pos, e.Y);
+        DrawList.AddLine(p1, p2, col, gp.Style.ErrorBarWeight);
+        if (rend_whisker) {
+            DrawList.AddLine(p1 - ImVec2(0, half_whisker), p1 + ImVec2(0, half_whisker), col, gp.Style.ErrorBarWeight);
+            DrawList.AddLine(p2 - ImVec2(0, half_whisker), p2 + ImVec2(0, half_whisker), col, gp.Style.ErrorBarWeight);
+        }
+    }
+    PopPlotClipRect();
+}
+
+//-----------------------------------------------------------------------------
+// PLOT DIGITAL
+//-----------------------------------------------------------------------------
+
+template <typename ItemId, typename Getter>
+inline void PlotDigitalEx(const ItemId& item_id, Getter getter)
+{
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotDigital() needs to be called between BeginPlot() and EndPlot()!");
+
+    ImPlotItem* item = RegisterOrGetItem(item_id);
+    if (!item->Show)
+        return;
+    TryRecolorItem(item, ImPlotCol_Line);
+    ClipGetterToView(getter);
+
+    // render digital signals as "pixel bases" rectangles
+    PushPlotClipRect();
+    if (getter.Count > 1 && WillLineRender()) {
+        ImDrawList & DrawList = *ImGui::GetWindowDrawList();
+        const float line_weight = item->Highlight ? gp.Style.LineWeight * 2 : gp.Style.LineWeight;
+        const int y_axis = gp.CurrentPlot->CurrentYAxis;
+        int pixYMax = 0;
+        ImPlotPoint itemData1 = getter(0);
+        for (int i = 0; i < getter.Count; ++i) {
+            ImPlotPoint itemData2 = getter(i);
+            if (NanOrInf(itemData1.y)) {
+                itemData1 = itemData2;
+                continue;
+            }
+            if (NanOrInf(itemData2.y)) itemData2.y = ConstrainNan(ConstrainInf(itemData2.y));
+            int pixY_0 = (int)(line_weight);
+            itemData1.y = ImMax(0.0, itemData1.y);
+            float pixY_1_float = gp.Style.DigitalBitHeight * (float)itemData1.y;
+            int pixY_1 = (int)(pixY_1_float); //allow only positive values
+            int pixY_chPosOffset = (int)(ImMax(gp.Style.DigitalBitHeight, pixY_1_float) + gp.Style.DigitalBitGap);
+            pixYMax = ImMax(pixYMax, pixY_chPosOffset);
+            ImVec2 pMin = PlotToPixels(itemData1);
+            ImVec2 pMax = PlotToPixels(itemData2);
+            int pixY_Offset = 20; //20 pixel from bottom due to mouse cursor label
+            pMin.y = (gp.PixelRange[y_axis].Min.y) + ((-gp.DigitalPlotOffset)                   - pixY_Offset);
+            pMax.y = (gp.PixelRange[y_axis].Min.y) + ((-gp.DigitalPlotOffset) - pixY_0 - pixY_1 - pixY_Offset);
+            //plot only one rectangle for same digital state
+            while (((i+2) < getter.Count) && (itemData1.y == itemData2.y)) {
+                const int in = (i + 1);
+                itemData2 = getter(in);
+                if (NanOrInf(itemData2.y)) break;
+                pMax.x = PlotToPixels(itemData2).x;
+                i++;
+            }
+            //do not extend plot outside plot range
+            if (pMin.x < gp.PixelRange[y_axis].Min.x) pMin.x = gp.PixelRange[y_axis].Min.x;
+            if (pMax.x < gp.PixelRange[y_axis].Min.x) pMax.x = gp.PixelRange[y_axis].Min.x;
+            if (pMin.x > gp.PixelRange[y_axis].Max.x) pMin.x = gp.PixelRange[y_axis].Max.x;
+            if (pMax.x > gp.PixelRange[y_axis].Max.x) pMax.x = gp.PixelRange[y_axis].Max.x;
+            //plot a rectangle that extends up to x2 with y1 height
+            if ((pMax.x > pMin.x) && (gp.BB_Plot.Contains(pMin) || gp.BB_Plot.Contains(pMax))) {
+                ImVec4 colAlpha = item->Color;
+                colAlpha.w = item->Highlight ? 1.0f : 0.9f;
+                DrawList.AddRectFilled(pMin, pMax, ImGui::GetColorU32(colAlpha));
+            }
+            itemData1 = itemData2;
+        }
+        gp.DigitalPlotItemCnt++;
+        gp.DigitalPlotOffset += pixYMax;
+    }
+    PopPlotClipRect();
+}
+
+//-----------------------------------------------------------------------------
+// PLOT RECTS
+//-----------------------------------------------------------------------------
+
+template <typename Getter>
+void PlotRectsEx(const char* label_id, Getter getter) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != NULL, "PlotRects() needs to be called between BeginPlot() and EndPlot()!");
+
+    ImPlotItem* item = RegisterOrGetItem(label_id);
+    if (!item->Show)
+        return;
+    TryRecolorItem(item, ImPlotCol_Fill);
+
+    if (!WillFillRender())
+        return;
+
+    if (gp.FitThisFrame) {
+        for (int i = 0; i < getter.Count; ++i) {
+            ImPlotPoint p = getter(i);
+            FitPoint(p);
+        }
+    }
+
+    ImDrawList & DrawList = *ImGui::GetWindowDrawList();
+    ImPlotState* plot = gp.CurrentPlot;
+    const int y_axis = plot->CurrentYAxis;
+    ImU32 col = ImGui::GetColorU32(GetItemFillColor(item));
+
+    PushPlotClipRect();
+    if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale) && ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+        RenderPrimitives(RectRenderer<Getter,TransformerLogLog>(getter, TransformerLogLog(y_axis), col), DrawList);
+    else if (ImHasFlag(plot->XAxis.Flags, ImPlotAxisFlags_LogScale))
+        RenderPrimitives(RectRenderer<Getter,TransformerLogLin>(getter, TransformerLogLin(y_axis), col), DrawList);
+    else if (ImHasFlag(plot->YAxis[y_axis].Flags, ImPlotAxisFlags_LogScale))
+        RenderPrimitives(RectRenderer<Getter,TransformerLinLog>(getter, TransformerLinLog(y_axis), col), DrawList);
+    else
+        RenderPrimitives(RectRenderer<Getter,TransformerLinLin>(getter, TransformerLinLin(y_axis), col), DrawList);
+    PopPlotClipRect();
+}
+
+}  // namespace ImPlot